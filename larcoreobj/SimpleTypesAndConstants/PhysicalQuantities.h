@@ -0,0 +1,349 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/PhysicalQuantities.h
+ * @brief  Strongly typed lengths, energies and angles with units.
+ * @see    larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ * A quantity (`util::units::Quantity`) is a value with a unit attached to its
+ * type. Quantities in different units of the same dimension convert into each
+ * other, with a conversion factor which is a compile time constant derived
+ * from the factors in `PhysicalConstants.h`; quantities of different
+ * dimensions can't be mixed, and attempting that is a compilation error.
+ * A quantity has the same size and layout as its value, and all its
+ * operations are `constexpr` and trivially inlined, so that it carries no
+ * overhead compared to the bare value.
+ *
+ * Example:
+ * @code
+ * using namespace util::units::literals;
+ *
+ * util::units::centimeter const driftLength = 2.5_m; // converted to 250 cm
+ * util::units::megaelectronvolt const E = 1.2_GeV + 350_MeV;
+ * double const c = util::units::cos(60_deg);
+ * @endcode
+ *
+ * The quantity types are not meant to be stored in data products, which keep
+ * using plain values in the standard LArSoft units (see `util` namespace).
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_PHYSICALQUANTITIES_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_PHYSICALQUANTITIES_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <ostream>
+#include <type_traits> // std::enable_if_t, std::is_same_v
+#include <cmath> // std::cos(), std::sin(), std::tan()
+
+
+/// Types for physical quantities with units.
+namespace util::units {
+
+  /// Tags of the physical dimensions of the quantities.
+  namespace dimension {
+    struct Length {}; ///< Length (reference unit: centimeter).
+    struct Energy {}; ///< Energy (reference unit: gigaelectronvolt).
+    struct Angle {}; ///< Plane angle (reference unit: radian).
+  } // namespace dimension
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @name Units
+   *
+   * Each unit describes its dimension (`dimension_t`), its size in the
+   * reference unit of the dimension (`scale`) and its `symbol`.
+   * The reference units are the standard LArSoft units.
+   */
+  /// @{
+
+  struct Centimeter {
+    using dimension_t = dimension::Length;
+    static constexpr double scale = 1.0;
+    static constexpr char const* symbol = "cm";
+  };
+  struct Meter {
+    using dimension_t = dimension::Length;
+    static constexpr double scale = kMeterToCentimeter;
+    static constexpr char const* symbol = "m";
+  };
+  struct Kilometer {
+    using dimension_t = dimension::Length;
+    static constexpr double scale = kKilometerToMeter * kMeterToCentimeter;
+    static constexpr char const* symbol = "km";
+  };
+
+  struct Electronvolt {
+    using dimension_t = dimension::Energy;
+    static constexpr double scale = keVToMeV * 1.e-3;
+    static constexpr char const* symbol = "eV";
+  };
+  struct Megaelectronvolt {
+    using dimension_t = dimension::Energy;
+    static constexpr double scale = 1.e-3;
+    static constexpr char const* symbol = "MeV";
+  };
+  struct Gigaelectronvolt {
+    using dimension_t = dimension::Energy;
+    static constexpr double scale = 1.0;
+    static constexpr char const* symbol = "GeV";
+  };
+
+  struct Radian {
+    using dimension_t = dimension::Angle;
+    static constexpr double scale = 1.0;
+    static constexpr char const* symbol = "rad";
+  };
+  struct Degree {
+    using dimension_t = dimension::Angle;
+    static constexpr double scale = DegreesToRadians(1.0);
+    static constexpr char const* symbol = "deg";
+  };
+
+  /// @}
+
+
+  /// Whether units `U1` and `U2` measure the same dimension.
+  template <typename U1, typename U2>
+  constexpr bool same_dimension_v = std::is_same_v
+    <typename U1::dimension_t, typename U2::dimension_t>;
+
+
+  /// Converts `value` from unit `From` into unit `To` (same dimension).
+  template <typename To, typename From, typename T>
+  constexpr T convertValue(T value)
+    {
+      static_assert(same_dimension_v<From, To>,
+        "Conversion between units of different dimensions");
+      if constexpr (std::is_same_v<From, To>) return value;
+      else {
+        constexpr double factor = From::scale / To::scale; // compile time
+        return value * T(factor);
+      }
+    } // convertValue()
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief A value of type `T` measured in the unit `U`.
+   * @tparam U the unit of the value (e.g. `util::units::Centimeter`)
+   * @tparam T the type of the value
+   *
+   * The quantity can be constructed from a plain value only explicitly.
+   * It converts implicitly into quantities of the same dimension in other
+   * units (with a rescaling of the value), and it never converts implicitly
+   * into a plain value: `value()` returns it.
+   *
+   * Arithmetic is supported among quantities of the same dimension (the
+   * result is in the unit of the left operand) and with plain numbers for
+   * scaling. The ratio of two quantities of the same dimension is a plain
+   * number. Products of quantities (e.g. areas) are not supported.
+   */
+  template <typename U, typename T = double>
+  class Quantity {
+
+    /// Enables a template on `OU` only if it has the same dimension as `U`.
+    template <typename OU>
+    using enable_if_compatible_t = std::enable_if_t<same_dimension_v<U, OU>>;
+
+  public:
+
+    using unit_t = U; ///< Unit of this quantity.
+    using value_t = T; ///< Type of the stored value.
+    using dimension_t = typename U::dimension_t; ///< Dimension of the unit.
+
+    /// Default constructor: value is not initialized.
+    constexpr Quantity() = default;
+
+    /// Constructor: uses `value` in the unit `U`.
+    explicit constexpr Quantity(T value): fValue(value) {}
+
+    /// Conversion from a quantity in a different unit of the same dimension.
+    template <
+      typename OU, typename OT,
+      typename = enable_if_compatible_t<OU>
+      >
+    constexpr Quantity(Quantity<OU, OT> other)
+      : fValue(convertValue<U, OU>(T(other.value())))
+      {}
+
+    /// Returns the value of the quantity in its unit `U`.
+    constexpr T value() const { return fValue; }
+
+    /// Returns this quantity converted in the unit `OU`.
+    template <typename OU, typename = enable_if_compatible_t<OU>>
+    constexpr Quantity<OU, T> in() const
+      { return Quantity<OU, T>{ convertValue<OU, U>(fValue) }; }
+
+    /// Returns the symbol of the unit.
+    static constexpr char const* unitSymbol() { return U::symbol; }
+
+    // --- BEGIN -- Arithmetic -------------------------------------------------
+    constexpr Quantity operator+ () const { return *this; }
+    constexpr Quantity operator- () const { return Quantity{ -fValue }; }
+
+    template <typename OU, typename = enable_if_compatible_t<OU>>
+    constexpr Quantity& operator+= (Quantity<OU, T> other)
+      { fValue += convertValue<U, OU>(other.value()); return *this; }
+
+    template <typename OU, typename = enable_if_compatible_t<OU>>
+    constexpr Quantity& operator-= (Quantity<OU, T> other)
+      { fValue -= convertValue<U, OU>(other.value()); return *this; }
+
+    constexpr Quantity& operator*= (T factor)
+      { fValue *= factor; return *this; }
+    constexpr Quantity& operator/= (T factor)
+      { fValue /= factor; return *this; }
+    // --- END -- Arithmetic ---------------------------------------------------
+
+  private:
+    T fValue; ///< The value, in unit `U`.
+
+  }; // class Quantity<>
+
+
+  // ---------------------------------------------------------------------------
+  /// @name Quantity arithmetic and comparisons
+  /// @{
+
+  template <typename U1, typename U2, typename T,
+    typename = std::enable_if_t<same_dimension_v<U1, U2>>
+    >
+  constexpr Quantity<U1, T> operator+ (Quantity<U1, T> a, Quantity<U2, T> b)
+    { return a += b; }
+
+  template <typename U1, typename U2, typename T,
+    typename = std::enable_if_t<same_dimension_v<U1, U2>>
+    >
+  constexpr Quantity<U1, T> operator- (Quantity<U1, T> a, Quantity<U2, T> b)
+    { return a -= b; }
+
+  template <typename U, typename T>
+  constexpr Quantity<U, T> operator* (Quantity<U, T> q, T factor)
+    { return q *= factor; }
+
+  template <typename U, typename T>
+  constexpr Quantity<U, T> operator* (T factor, Quantity<U, T> q)
+    { return q *= factor; }
+
+  template <typename U, typename T>
+  constexpr Quantity<U, T> operator/ (Quantity<U, T> q, T factor)
+    { return q /= factor; }
+
+  /// Ratio of two quantities of the same dimension, as a plain number.
+  template <typename U1, typename U2, typename T,
+    typename = std::enable_if_t<same_dimension_v<U1, U2>>
+    >
+  constexpr T operator/ (Quantity<U1, T> a, Quantity<U2, T> b)
+    { return a.value() / convertValue<U1, U2>(b.value()); }
+
+  #define LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(OP)                        \
+    template <typename U1, typename U2, typename T,                            \
+      typename = std::enable_if_t<same_dimension_v<U1, U2>>                    \
+      >                                                                        \
+    constexpr bool operator OP (Quantity<U1, T> a, Quantity<U2, T> b)          \
+      { return a.value() OP convertValue<U1, U2>(b.value()); }
+
+  LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(==)
+  LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(!=)
+  LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(<)
+  LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(<=)
+  LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(>)
+  LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON(>=)
+
+  #undef LARCOREOBJ_PHYSICALQUANTITIES_COMPARISON
+
+  /// Prints the value of the quantity followed by its unit symbol.
+  template <typename U, typename T>
+  std::ostream& operator<< (std::ostream& out, Quantity<U, T> q)
+    { return out << q.value() << " " << U::symbol; }
+
+  /// @}
+
+
+  // ---------------------------------------------------------------------------
+  /// @name Trigonometric functions of angles (in any angle unit)
+  /// @{
+
+  template <typename U, typename T,
+    typename = std::enable_if_t<same_dimension_v<U, Radian>>
+    >
+  T cos(Quantity<U, T> angle)
+    { return std::cos(convertValue<Radian, U>(angle.value())); }
+
+  template <typename U, typename T,
+    typename = std::enable_if_t<same_dimension_v<U, Radian>>
+    >
+  T sin(Quantity<U, T> angle)
+    { return std::sin(convertValue<Radian, U>(angle.value())); }
+
+  template <typename U, typename T,
+    typename = std::enable_if_t<same_dimension_v<U, Radian>>
+    >
+  T tan(Quantity<U, T> angle)
+    { return std::tan(convertValue<Radian, U>(angle.value())); }
+
+  /// @}
+
+
+  // ---------------------------------------------------------------------------
+  /// @name Quantity types
+  /// @{
+
+  template <typename T = double> using centimeter_as = Quantity<Centimeter, T>;
+  template <typename T = double> using meter_as = Quantity<Meter, T>;
+  template <typename T = double> using kilometer_as = Quantity<Kilometer, T>;
+
+  template <typename T = double>
+  using electronvolt_as = Quantity<Electronvolt, T>;
+  template <typename T = double>
+  using megaelectronvolt_as = Quantity<Megaelectronvolt, T>;
+  template <typename T = double>
+  using gigaelectronvolt_as = Quantity<Gigaelectronvolt, T>;
+
+  template <typename T = double> using radian_as = Quantity<Radian, T>;
+  template <typename T = double> using degree_as = Quantity<Degree, T>;
+
+  using centimeter = centimeter_as<>;
+  using meter = meter_as<>;
+  using kilometer = kilometer_as<>;
+  using electronvolt = electronvolt_as<>;
+  using megaelectronvolt = megaelectronvolt_as<>;
+  using gigaelectronvolt = gigaelectronvolt_as<>;
+  using radian = radian_as<>;
+  using degree = degree_as<>;
+
+  /// @}
+
+
+  // ---------------------------------------------------------------------------
+  /// User-defined literals for the quantities (e.g. `2.5_m`, `60_deg`).
+  namespace literals {
+
+    #define LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(SUFFIX, QUANTITY)            \
+      constexpr QUANTITY operator""_##SUFFIX (long double v)                   \
+        { return QUANTITY{ static_cast<double>(v) }; }                         \
+      constexpr QUANTITY operator""_##SUFFIX (unsigned long long int v)        \
+        { return QUANTITY{ static_cast<double>(v) }; }
+
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(cm, centimeter)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(m, meter)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(km, kilometer)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(eV, electronvolt)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(MeV, megaelectronvolt)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(GeV, gigaelectronvolt)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(rad, radian)
+    LARCOREOBJ_PHYSICALQUANTITIES_LITERAL(deg, degree)
+
+    #undef LARCOREOBJ_PHYSICALQUANTITIES_LITERAL
+
+  } // namespace literals
+
+} // namespace util::units
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_PHYSICALQUANTITIES_H
@@ -0,0 +1,300 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/Recombination.h
+ * @brief  Recombination models based on the constants in `PhysicalConstants.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RECOMBINATION_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RECOMBINATION_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <stdexcept> // std::length_error
+#include <algorithm> // std::max()
+#include <cmath> // std::log(), std::exp()
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  /// Number of ionization electrons per MeV of deposited energy.
+  constexpr double kMeVToElectrons = kGeVToElectrons * 1.e-3;
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Birks recombination model.
+   *
+   * The fraction of ionization charge surviving recombination is
+   * @f$ R = A / (1 + k' dE/dx) @f$, with @f$ k' = k / (\rho E) @f$ where
+   * @f$ \rho @f$ is the liquid argon density (g/cm&sup3;) and @f$ E @f$ the
+   * electric field (kV/cm). The coefficients default to `util::kRecombA` and
+   * `util::kRecombk`.
+   *
+   * Units: @f$ dE/dx @f$ in MeV/cm, @f$ dQ/dx @f$ in electrons/cm.
+   *
+   * All the member functions are templates on the arithmetic type, so that the
+   * same object evaluates the model in single or double precision.
+   */
+  class BirksRecombination {
+
+  public:
+
+    /// Constructor: model for the specified field and argon density.
+    constexpr BirksRecombination(
+      double EField, double density,
+      double A = kRecombA, double k = kRecombk,
+      double electronsPerMeV = kMeVToElectrons
+      )
+      : fA(A)
+      , fKprime(k / (density * EField))
+      , fElectronsPerMeV(electronsPerMeV)
+      {}
+
+    /// Returns the _A_ parameter of the model.
+    constexpr double A() const { return fA; }
+
+    /// Returns the _k_ parameter already scaled by density and field [cm/MeV].
+    constexpr double kPrime() const { return fKprime; }
+
+    /// Returns the number of ionization electrons per MeV.
+    constexpr double electronsPerMeV() const { return fElectronsPerMeV; }
+
+    /// Returns the recombination factor for the specified `dEdx` [MeV/cm].
+    template <typename T>
+    constexpr T recombination(T dEdx) const
+      { return T(fA) / (T(1) + T(fKprime) * dEdx); }
+
+    /// Returns the collected @f$ dQ/dx @f$ [e/cm] for `dEdx` [MeV/cm].
+    template <typename T>
+    constexpr T dQdx(T dEdx) const
+      { return T(fElectronsPerMeV) * dEdx * recombination(dEdx); }
+
+    /// Returns the @f$ dE/dx @f$ [MeV/cm] producing `dQdx` [e/cm].
+    template <typename T>
+    constexpr T dEdx(T dQdx) const
+      { return dQdx / (T(fElectronsPerMeV * fA) - T(fKprime) * dQdx); }
+
+  private:
+    double fA; ///< _A_ parameter.
+    double fKprime; ///< _k_ parameter divided by density and field [cm/MeV].
+    double fElectronsPerMeV; ///< Electrons produced per MeV deposited.
+
+  }; // class BirksRecombination
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Modified box recombination model.
+   *
+   * The fraction of ionization charge surviving recombination is
+   * @f$ R = \log(\alpha + \xi) / \xi @f$, with @f$ \xi = \beta' dE/dx @f$ and
+   * @f$ \beta' = \beta / (\rho E) @f$ where @f$ \rho @f$ is the liquid argon
+   * density (g/cm&sup3;) and @f$ E @f$ the electric field (kV/cm).
+   * The coefficients default to `util::kModBoxA` and `util::kModBoxB`.
+   *
+   * Units: @f$ dE/dx @f$ in MeV/cm, @f$ dQ/dx @f$ in electrons/cm.
+   *
+   * All the member functions are templates on the arithmetic type, so that the
+   * same object evaluates the model in single or double precision.
+   */
+  class ModBoxRecombination {
+
+  public:
+
+    /// Constructor: model for the specified field and argon density.
+    constexpr ModBoxRecombination(
+      double EField, double density,
+      double A = kModBoxA, double B = kModBoxB,
+      double electronsPerMeV = kMeVToElectrons
+      )
+      : fA(A)
+      , fBprime(B / (density * EField))
+      , fElectronsPerMeV(electronsPerMeV)
+      {}
+
+    /// Returns the @f$ \alpha @f$ parameter of the model.
+    constexpr double A() const { return fA; }
+
+    /// Returns @f$ \beta @f$ already scaled by density and field [cm/MeV].
+    constexpr double BPrime() const { return fBprime; }
+
+    /// Returns the number of ionization electrons per MeV.
+    constexpr double electronsPerMeV() const { return fElectronsPerMeV; }
+
+    /// Returns the recombination factor for the specified `dEdx` [MeV/cm].
+    template <typename T>
+    T recombination(T dEdx) const
+      {
+        T const xi = T(fBprime) * dEdx;
+        return std::log(T(fA) + xi) / xi;
+      }
+
+    /// Returns the collected @f$ dQ/dx @f$ [e/cm] for `dEdx` [MeV/cm].
+    template <typename T>
+    T dQdx(T dEdx) const
+      {
+        return T(fElectronsPerMeV / fBprime)
+          * std::log(T(fA) + T(fBprime) * dEdx);
+      }
+
+    /// Returns the @f$ dE/dx @f$ [MeV/cm] producing `dQdx` [e/cm].
+    template <typename T>
+    T dEdx(T dQdx) const
+      {
+        return (std::exp(T(fBprime / fElectronsPerMeV) * dQdx) - T(fA))
+          / T(fBprime);
+      }
+
+  private:
+    double fA; ///< @f$ \alpha @f$ parameter.
+    double fBprime; ///< @f$ \beta @f$ divided by density and field [cm/MeV].
+    double fElectronsPerMeV; ///< Electrons produced per MeV deposited.
+
+  }; // class ModBoxRecombination
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @name Batch recombination conversions
+   *
+   * These functions apply a recombination model (`util::BirksRecombination`,
+   * `util::ModBoxRecombination` or any class with the same interface) to
+   * `n` contiguous values starting at `in`, writing the results starting at
+   * `out` (which may be the same as `in`).
+   *
+   * The loops have no branches and all the model coefficients are loop
+   * invariant, so that the compiler can vectorize them where the target and
+   * the math library allow it; each element is computed with the scalar
+   * functions of the model, which are then the reference and the fallback.
+   * The versions taking STL vectors return a new vector with the results.
+   */
+  /// @{
+
+  /// Converts `n` values of @f$ dQ/dx @f$ from `in` into @f$ dE/dx @f$.
+  template <typename Model, typename T>
+  void dEdxFromdQdx(Model const& model, T const* in, T* out, std::size_t n)
+    { for (std::size_t i = 0; i < n; ++i) out[i] = model.dEdx(in[i]); }
+
+  /// Converts `n` values of @f$ dE/dx @f$ from `in` into @f$ dQ/dx @f$.
+  template <typename Model, typename T>
+  void dQdxFromdEdx(Model const& model, T const* in, T* out, std::size_t n)
+    { for (std::size_t i = 0; i < n; ++i) out[i] = model.dQdx(in[i]); }
+
+  /// Computes the recombination factor for `n` values of @f$ dE/dx @f$.
+  template <typename Model, typename T>
+  void recombinationFactors
+    (Model const& model, T const* dEdx, T* out, std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i) out[i] = model.recombination(dEdx[i]);
+    }
+
+  /// Returns the @f$ dE/dx @f$ values for all the `dQdx` values.
+  template <typename Model, typename T>
+  std::vector<T> dEdxFromdQdx(Model const& model, std::vector<T> const& dQdx)
+    {
+      std::vector<T> dEdx(dQdx.size());
+      dEdxFromdQdx(model, dQdx.data(), dEdx.data(), dQdx.size());
+      return dEdx;
+    }
+
+  /// Returns the @f$ dQ/dx @f$ values for all the `dEdx` values.
+  template <typename Model, typename T>
+  std::vector<T> dQdxFromdEdx(Model const& model, std::vector<T> const& dEdx)
+    {
+      std::vector<T> dQdx(dEdx.size());
+      dQdxFromdEdx(model, dEdx.data(), dQdx.data(), dEdx.size());
+      return dQdx;
+    }
+
+  /// @}
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @name Ionization electrons from energy deposits
+   *
+   * These functions compute in a single pass the number of ionization
+   * electrons which survive recombination and attachment, for a sequence of
+   * energy deposits:
+   * @f[ N_{e} = Y E \cdot R(dE/dx) \cdot e^{-t/\tau} @f]
+   * where @f$ E @f$ is the deposited energy (GeV), @f$ Y @f$ is the ionization
+   * yield of the recombination model (`util::kGeVToElectrons` by default),
+   * @f$ R @f$ is the recombination factor of the model, @f$ t @f$ is the drift
+   * time and @f$ \tau @f$ the electron lifetime.
+   * Drift time and lifetime must be in the same unit; an infinite lifetime
+   * disables the attenuation.
+   *
+   * The @f$ dE/dx @f$ values (MeV/cm) are raised to at least `minDEdx` before
+   * the evaluation of the recombination, which protects the models from
+   * deposits with no or very small track length.
+   *
+   * The computation is performed with the precision of the input values,
+   * while the result may be stored with a different type (e.g. `float`
+   * electrons from `double` deposits).
+   */
+  /// @{
+
+  /**
+   * @brief Computes ionization electrons for `n` contiguous energy deposits.
+   * @param model the recombination model
+   * @param lifetime electron lifetime
+   * @param minDEdx smallest @f$ dE/dx @f$ used in the recombination [MeV/cm]
+   * @param n number of deposits
+   * @param energy pointer to the deposited energies [GeV]
+   * @param dEdx pointer to the @f$ dE/dx @f$ of the deposits [MeV/cm]
+   * @param driftTime pointer to the drift times of the deposits
+   * @param electrons pointer to the first of `n` results
+   */
+  template <typename Model, typename T, typename E>
+  void ionizationElectrons(
+    Model const& model, double lifetime, double minDEdx,
+    std::size_t n, T const* energy, T const* dEdx, T const* driftTime,
+    E* electrons
+    )
+    {
+      T const electronsPerGeV = T(model.electronsPerMeV() * 1.e3);
+      T const invLifetime = T(1.0 / lifetime);
+      T const clampDEdx = T(minDEdx);
+      for (std::size_t i = 0; i < n; ++i) {
+        T const R = model.recombination(std::max(dEdx[i], clampDEdx));
+        electrons[i] = static_cast<E>(
+          energy[i] * electronsPerGeV * R
+          * std::exp(-driftTime[i] * invLifetime)
+          );
+      } // for
+    } // ionizationElectrons()
+
+  /// Returns the ionization electrons of the deposits in the vectors.
+  /// @throw std::length_error if the input vectors have different sizes
+  template <typename E = double, typename Model, typename T>
+  std::vector<E> ionizationElectrons(
+    Model const& model, double lifetime, double minDEdx,
+    std::vector<T> const& energy, std::vector<T> const& dEdx,
+    std::vector<T> const& driftTime
+    )
+    {
+      if ((dEdx.size() != energy.size()) || (driftTime.size() != energy.size()))
+      {
+        throw std::length_error(
+          "util::ionizationElectrons(): input vectors have different sizes"
+          );
+      }
+      std::vector<E> electrons(energy.size());
+      ionizationElectrons(model, lifetime, minDEdx, energy.size(),
+        energy.data(), dEdx.data(), driftTime.data(), electrons.data());
+      return electrons;
+    } // ionizationElectrons(std::vector)
+
+  /// @}
+
+} // namespace util
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RECOMBINATION_H
@@ -0,0 +1,241 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/TabulatedRecombination.h
+ * @brief  Interpolated evaluation of the modified box recombination model.
+ * @see    larcoreobj/SimpleTypesAndConstants/Recombination.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_TABULATEDRECOMBINATION_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_TABULATEDRECOMBINATION_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/Recombination.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <string>
+#include <stdexcept> // std::domain_error
+#include <algorithm> // std::max()
+#include <initializer_list>
+#include <cmath> // std::log(), std::abs()
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  /**
+   * @brief Modified box model with tabulated logarithm.
+   *
+   * The conversion from @f$ dE/dx @f$ to @f$ dQ/dx @f$ of the modified box
+   * model (`util::ModBoxRecombination`) is dominated by the evaluation of a
+   * logarithm. This object replaces it with a linear interpolation on a
+   * uniform table covering a chosen @f$ dE/dx @f$ range.
+   *
+   * The table is built at construction, with the smallest size that keeps the
+   * relative error of @f$ dQ/dx @f$ within the requested bound over the whole
+   * range; values outside the range are computed with the exact formula.
+   * Construction fails with `std::domain_error` if the bound can't be met with
+   * a reasonably sized table: that happens when the range reaches close to the
+   * @f$ dE/dx @f$ where the model predicts no collected charge
+   * (@f$ \alpha + \xi = 1 @f$), because there the relative error diverges.
+   *
+   * The object is not modified after construction, and it is safe to share a
+   * single instance among threads (e.g. via
+   * `std::shared_ptr<util::TabulatedModBoxRecombination const>`).
+   *
+   * It supports the part of the interface of `util::ModBoxRecombination` that
+   * converts @f$ dE/dx @f$ into @f$ dQ/dx @f$, and in particular it can be
+   * used with `util::dQdxFromdEdx()`.
+   */
+  class TabulatedModBoxRecombination {
+
+  public:
+
+    /// Largest number of intervals the table can be made of.
+    static constexpr std::size_t MaxIntervals = 1U << 20;
+
+    /**
+     * @brief Constructor: tabulates `model` between `minDEdx` and `maxDEdx`.
+     * @param model the exact model to be tabulated
+     * @param minDEdx lower end of the tabulated range [MeV/cm]
+     * @param maxDEdx upper end of the tabulated range [MeV/cm]
+     * @param maxRelError maximum relative error of @f$ dQ/dx @f$ in the range
+     * @throw std::domain_error if the range is invalid or `maxRelError` can't
+     *        be achieved with at most `MaxIntervals` intervals
+     */
+    TabulatedModBoxRecombination(
+      ModBoxRecombination const& model,
+      double minDEdx, double maxDEdx,
+      double maxRelError = 1e-4
+      );
+
+    /// Returns the exact model this table reproduces.
+    ModBoxRecombination const& model() const { return fModel; }
+
+    /// Returns the lower end of the tabulated range [MeV/cm].
+    double minDEdx() const { return fMin; }
+
+    /// Returns the upper end of the tabulated range [MeV/cm].
+    double maxDEdx() const { return fMax; }
+
+    /// Returns the number of intervals in the table.
+    std::size_t nIntervals() const { return fTable.size() - 1U; }
+
+    /// Returns the relative error bound requested at construction.
+    double maxRelError() const { return fMaxRelError; }
+
+    /// Returns the relative error measured when building the table.
+    double measuredRelError() const { return fMeasuredRelError; }
+
+    /// Returns the collected @f$ dQ/dx @f$ [e/cm] for `dEdx` [MeV/cm].
+    template <typename T>
+    T dQdx(T dEdx) const;
+
+    /// Returns the recombination factor for the specified `dEdx` [MeV/cm].
+    template <typename T>
+    T recombination(T dEdx) const
+      { return dQdx(dEdx) / (T(fModel.electronsPerMeV()) * dEdx); }
+
+  private:
+
+    /// Value and slope of the tabulated function at the start of an interval.
+    struct Node_t { double value; double slope; };
+
+    ModBoxRecombination fModel; ///< The exact model.
+    double fMin; ///< Lower end of the tabulated range.
+    double fMax; ///< Upper end of the tabulated range.
+    double fStep = 0.0; ///< Width of the interval.
+    double fInvStep = 0.0; ///< Inverse of the width of the interval.
+    double fScale; ///< Factor converting the tabulated logarithm into dQ/dx.
+    double fMaxRelError; ///< Requested bound on the relative error.
+    double fMeasuredRelError = 0.0; ///< Largest relative error measured.
+
+    std::vector<Node_t> fTable; ///< Table of values (and slopes).
+
+    /// The function being tabulated: @f$ \log(\alpha + \beta' x) @f$.
+    double exactLog(double dEdx) const
+      { return std::log(fModel.A() + fModel.BPrime() * dEdx); }
+
+    /// Fills the table with `nIntervals` intervals.
+    void fillTable(std::size_t nIntervals);
+
+    /// Returns the largest relative error at interval midpoints and quarters.
+    double measureRelError() const;
+
+    /// Interpolates the table at `dEdx`, which must be within the range.
+    double interpolate(double dEdx) const;
+
+  }; // class TabulatedModBoxRecombination
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- inline and template implementation
+//------------------------------------------------------------------------------
+inline util::TabulatedModBoxRecombination::TabulatedModBoxRecombination(
+  ModBoxRecombination const& model,
+  double minDEdx, double maxDEdx,
+  double maxRelError /* = 1e-4 */
+)
+  : fModel(model)
+  , fMin(minDEdx)
+  , fMax(maxDEdx)
+  , fScale(model.electronsPerMeV() / model.BPrime())
+  , fMaxRelError(maxRelError)
+{
+  if (!(minDEdx < maxDEdx) || !(maxRelError > 0.0)) {
+    throw std::domain_error(
+      "util::TabulatedModBoxRecombination: invalid range ["
+      + std::to_string(minDEdx) + "; " + std::to_string(maxDEdx)
+      + "] or error bound " + std::to_string(maxRelError)
+      );
+  }
+  if (fModel.A() + fModel.BPrime() * minDEdx <= 1.0) {
+    throw std::domain_error(
+      "util::TabulatedModBoxRecombination: no collected charge predicted at "
+      + std::to_string(minDEdx) + " MeV/cm"
+      );
+  }
+
+  // linear interpolation error scales with the square of the interval width:
+  // refine until the measured error is safely below the requested bound
+  std::size_t nIntervals = 16U;
+  while (true) {
+    fillTable(nIntervals);
+    fMeasuredRelError = measureRelError();
+    if (fMeasuredRelError <= maxRelError / 2.0) break;
+    if (nIntervals >= MaxIntervals) {
+      throw std::domain_error(
+        "util::TabulatedModBoxRecombination: relative error "
+        + std::to_string(fMeasuredRelError) + " with "
+        + std::to_string(nIntervals) + " intervals, can't achieve "
+        + std::to_string(maxRelError)
+        );
+    }
+    nIntervals *= 2U;
+  } // while
+
+} // util::TabulatedModBoxRecombination::TabulatedModBoxRecombination()
+
+
+//------------------------------------------------------------------------------
+inline void util::TabulatedModBoxRecombination::fillTable
+  (std::size_t nIntervals)
+{
+  fStep = (fMax - fMin) / nIntervals;
+  fInvStep = nIntervals / (fMax - fMin);
+
+  fTable.resize(nIntervals + 1U);
+  double value = exactLog(fMin);
+  for (std::size_t i = 0; i < nIntervals; ++i) {
+    double const next = exactLog(fMin + (i + 1) * fStep);
+    fTable[i] = { value, next - value };
+    value = next;
+  } // for
+  fTable.back() = { value, 0.0 }; // used only for `dEdx == fMax`
+
+} // util::TabulatedModBoxRecombination::fillTable()
+
+
+//------------------------------------------------------------------------------
+inline double util::TabulatedModBoxRecombination::measureRelError() const {
+  double maxError = 0.0;
+  std::size_t const n = nIntervals();
+  for (std::size_t i = 0; i < n; ++i) {
+    for (double const f: { 0.25, 0.5, 0.75 }) {
+      double const x = fMin + (i + f) * fStep;
+      double const exact = exactLog(x);
+      maxError
+        = std::max(maxError, std::abs((interpolate(x) - exact) / exact));
+    } // for f
+  } // for i
+  return maxError;
+} // util::TabulatedModBoxRecombination::measureRelError()
+
+
+//------------------------------------------------------------------------------
+inline double util::TabulatedModBoxRecombination::interpolate
+  (double dEdx) const
+{
+  double const pos = (dEdx - fMin) * fInvStep;
+  std::size_t const i = static_cast<std::size_t>(pos);
+  Node_t const& node = fTable[i];
+  return node.value + (pos - i) * node.slope;
+} // util::TabulatedModBoxRecombination::interpolate()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+T util::TabulatedModBoxRecombination::dQdx(T dEdx) const {
+  // written so that NaN is also left to the model, never used as an index
+  if (!((dEdx >= fMin) && (dEdx <= fMax))) return fModel.dQdx(dEdx);
+  return static_cast<T>(fScale * interpolate(dEdx));
+} // util::TabulatedModBoxRecombination::dQdx()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_TABULATEDRECOMBINATION_H
@@ -0,0 +1,90 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/angle_conversions.h
+ * @brief  Conversions of many angles between degrees and radians.
+ * @see    larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h
+ *
+ * This library is header-only and depends only on standard C++.
+ * The conversions of single angles are in `PhysicalConstants.h`.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_ANGLE_CONVERSIONS_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_ANGLE_CONVERSIONS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::pi()
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  /**
+   * @{
+   * @name Batch angle conversions
+   *
+   * These functions convert `n` contiguous angles starting at `in`, writing
+   * the results starting at `out` (which may be the same as `in`); the
+   * versions taking a STL vector return a new vector with the results.
+   * The conversion factor is computed once, and each angle is converted with a
+   * single multiplication: results may differ from the ones of the scalar
+   * functions in the last bit.
+   */
+  template <typename T>
+  void DegreesToRadians(T const* in, T* out, std::size_t n);
+
+  template <typename T>
+  void RadiansToDegrees(T const* in, T* out, std::size_t n);
+
+  template <typename T>
+  std::vector<T> DegreesToRadians(std::vector<T> const& angles);
+
+  template <typename T>
+  std::vector<T> RadiansToDegrees(std::vector<T> const& angles);
+  /// @}
+
+} // namespace util
+
+
+// -----------------------------------------------------------------------------
+// --- template implementation
+// -----------------------------------------------------------------------------
+template <typename T>
+void util::DegreesToRadians(T const* in, T* out, std::size_t n) {
+  T const factor = pi<T>() / 180;
+  for (std::size_t i = 0; i < n; ++i) out[i] = in[i] * factor;
+} // util::DegreesToRadians(T const*)
+
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void util::RadiansToDegrees(T const* in, T* out, std::size_t n) {
+  T const factor = 180 / pi<T>();
+  for (std::size_t i = 0; i < n; ++i) out[i] = in[i] * factor;
+} // util::RadiansToDegrees(T const*)
+
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::vector<T> util::DegreesToRadians(std::vector<T> const& angles) {
+  std::vector<T> res(angles.size());
+  DegreesToRadians(angles.data(), res.data(), angles.size());
+  return res;
+} // util::DegreesToRadians(std::vector)
+
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::vector<T> util::RadiansToDegrees(std::vector<T> const& angles) {
+  std::vector<T> res(angles.size());
+  RadiansToDegrees(angles.data(), res.data(), angles.size());
+  return res;
+} // util::RadiansToDegrees(std::vector)
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_ANGLE_CONVERSIONS_H
@@ -0,0 +1,933 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h
+ * @brief  Packed keys and dense indices for geometry and readout IDs.
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_types.h
+ *
+ * This library is header-only and depends only on standard C++ (and the ID
+ * definitions). Aliases for readout IDs are in
+ * `larcoreobj/SimpleTypesAndConstants/readout_id_indexing.h`.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_INDEXING_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_INDEXING_H
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <algorithm> // std::sort(), std::unique()
+#include <iterator> // std::forward_iterator_tag
+#include <utility> // std::index_sequence, std::pair
+#include <limits> // std::numeric_limits
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <string>
+#include <cstdint> // std::uint64_t, std::uint32_t
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+namespace geo {
+
+  // --- BEGIN -- Packed ID keys -----------------------------------------------
+  /**
+   * @name Packed ID keys
+   *
+   * A packed key encodes a whole ID (of up to four levels, like `geo::WireID`
+   * or `readout::ROPID`) into a single 64-bit integer, 16 bits per level, the
+   * top level (cryostat) in the most significant bits. Levels deeper than the
+   * one of the ID are set to `0`.
+   * Packed keys of IDs of the same type sort in the same order as the IDs, so
+   * that a sorted array of keys can be searched for an ID with a single integer
+   * comparison per step.
+   *
+   * All valid indices must be smaller than `PackedIDinvalidIndex` (65535).
+   * An invalid ID is packed into `InvalidPackedIDkey`.
+   */
+  /// @{
+
+  /// Type of packed ID key.
+  using PackedIDkey_t = std::uint64_t;
+
+  /// Number of bits used for the index of each level.
+  constexpr unsigned int PackedIDindexBits = 16U;
+
+  /// Maximum number of levels in a packed key.
+  constexpr std::size_t PackedIDmaxLevels = 64U / PackedIDindexBits;
+
+  /// Value of a packed index marking it as invalid.
+  constexpr PackedIDkey_t PackedIDinvalidIndex
+    = (PackedIDkey_t{ 1U } << PackedIDindexBits) - 1U;
+
+  /// Packed key of an invalid ID.
+  constexpr PackedIDkey_t InvalidPackedIDkey = ~PackedIDkey_t{ 0U };
+
+
+  /**
+   * @brief Returns the packed key of the specified ID.
+   * @tparam ID type of ID to be packed
+   * @param id the ID to be packed
+   * @return the packed key of `id` (`InvalidPackedIDkey` if `id` is invalid)
+   * @throw std::out_of_range if an index of `id` does not fit in 16 bits
+   */
+  template <typename ID>
+  constexpr PackedIDkey_t packID(ID const& id);
+
+  /**
+   * @brief Returns the ID encoded in the specified packed key.
+   * @tparam ID type of ID to be unpacked
+   * @param key the packed key
+   * @return the ID from `key` (invalid if `key` is `InvalidPackedIDkey`)
+   */
+  template <typename ID>
+  constexpr ID unpackID(PackedIDkey_t key);
+
+  /// @}
+  // --- END -- Packed ID keys -------------------------------------------------
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Dense indexing of IDs with fixed extents at each level.
+   * @tparam Levels number of levels described
+   *
+   * The layout describes a detector where each element of a level has the same
+   * number of children (the _extent_ of the next level), e.g. 2 cryostats,
+   * 4 TPCs per cryostat, 3 planes per TPC, up to 5000 wires per plane:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::IDlayout<4U> const layout {{ 2U, 4U, 3U, 5000U }};
+   *
+   * std::size_t const index = layout.index(geo::WireID{ 1U, 0U, 2U, 8U });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Each ID within the extents is assigned a dense index between `0` and
+   * `size()`, following the natural ID sorting. An ID with fewer levels than
+   * the layout (e.g. `geo::PlaneID` with the layout above) is indexed using
+   * only the extents of its levels.
+   * When the actual number of elements varies (e.g. number of wires in
+   * different planes), the extent is the largest one and some indices are not
+   * used.
+   *
+   * All methods are `constexpr`.
+   */
+  template <std::size_t Levels>
+  class IDlayout {
+    static_assert(Levels > 0U, "An ID layout needs at least one level.");
+
+  public:
+
+    /// Number of levels in the layout.
+    static constexpr std::size_t NLevels = Levels;
+
+    /// Type of list of the extents of all levels.
+    using Extents_t = std::array<std::size_t, Levels>;
+
+    /// Constructor: sets the extent of each level (top level first).
+    constexpr IDlayout(Extents_t const& extents): fExtents(extents) {}
+
+    /// Returns the extents of all the levels.
+    constexpr Extents_t const& extents() const { return fExtents; }
+
+    /// Returns the extent of the specified level.
+    constexpr std::size_t extent(std::size_t level) const
+      { return fExtents[level]; }
+
+    /// Returns the number of indices for IDs of type `ID`.
+    template <typename ID>
+    constexpr std::size_t size() const;
+
+    /// Returns the number of indices for IDs with all the levels.
+    constexpr std::size_t size() const { return sizeUpTo(Levels); }
+
+    /// Returns whether `id` is valid and within the extents of the layout.
+    template <typename ID>
+    constexpr bool contains(ID const& id) const;
+
+    /// Returns the dense index of `id` (undefined if `!contains(id)`).
+    template <typename ID>
+    constexpr std::size_t index(ID const& id) const;
+
+    /// Returns the ID with the specified dense `index`.
+    template <typename ID>
+    constexpr ID makeID(std::size_t index) const;
+
+    /// Returns the layout of the top `N` levels of this one.
+    template <std::size_t N>
+    constexpr IDlayout<N> upperLayout() const;
+
+  private:
+
+    Extents_t fExtents; ///< Extents of all the levels, top first.
+
+    /// Returns the product of the extents of the first `nLevels` levels.
+    constexpr std::size_t sizeUpTo(std::size_t nLevels) const;
+
+    template <typename ID, std::size_t... L>
+    constexpr bool containsImpl(ID const& id, std::index_sequence<L...>) const;
+
+    template <typename ID, std::size_t... L>
+    constexpr std::size_t indexImpl
+      (ID const& id, std::index_sequence<L...>) const;
+
+    template <typename ID, std::size_t... L>
+    constexpr ID makeIDimpl
+      (std::size_t index, std::index_sequence<L...>) const;
+
+  }; // class IDlayout
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Container with one element per ID, with O(1) access by ID.
+   * @tparam ID type of ID the elements are indexed by
+   * @tparam T type of the contained elements
+   *
+   * The container holds one element for each ID in a `geo::IDlayout` with as
+   * many levels as `ID` has, stored contiguously in the order of their dense
+   * index (i.e. in the natural ID sorting). For example, a baseline for each
+   * readout plane:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::IDcontainer<readout::ROPID, float> baselines
+   *   { geo::IDlayout<3U>{{ 1U, 4U, 3U }}, 0.0f };
+   *
+   * baselines[readout::ROPID{ 0U, 2U, 1U }] = 2048.0f;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Access via `operator[]` is a multiplication and an addition per level
+   * and no check; `at()` also checks that the ID is in the layout.
+   * Iteration runs through the elements in dense index order; the ID of an
+   * element can be recovered with `elementID(index)`.
+   */
+  template <typename ID, typename T>
+  class IDcontainer {
+
+  public:
+
+    using ID_t = ID; ///< Type of ID indexing the elements.
+    using value_type = T; ///< Type of contained element.
+
+    /// Type of the layout of the IDs.
+    using Layout_t = IDlayout<ID_t::Level + 1U>;
+
+    using reference = typename std::vector<T>::reference;
+    using const_reference = typename std::vector<T>::const_reference;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    /// Constructor: one element per ID in `layout`, each a copy of `value`.
+    explicit IDcontainer(Layout_t const& layout, T const& value = T{})
+      : fLayout(layout), fData(fLayout.size(), value) {}
+
+    /// Constructor: one element per ID in the top levels of `layout`.
+    template <std::size_t L>
+    explicit IDcontainer(IDlayout<L> const& layout, T const& value = T{})
+      : IDcontainer(layout.template upperLayout<Layout_t::NLevels>(), value)
+      {}
+
+    /// Returns the layout of the IDs of the container.
+    Layout_t const& layout() const { return fLayout; }
+
+    /// Returns the number of elements (one per ID in the layout).
+    std::size_t size() const { return fData.size(); }
+
+    /// Returns whether the container has no elements.
+    bool empty() const { return fData.empty(); }
+
+    /// Returns whether there is an element for `id`.
+    bool hasElement(ID_t const& id) const { return fLayout.contains(id); }
+
+    /// Returns the dense index of the element of `id`.
+    std::size_t indexOf(ID_t const& id) const { return fLayout.index(id); }
+
+    /// Returns the ID of the element with the specified dense `index`.
+    ID_t elementID(std::size_t index) const
+      { return fLayout.template makeID<ID_t>(index); }
+
+    /// Returns the element of `id` (undefined if `!hasElement(id)`).
+    reference operator[] (ID_t const& id) { return fData[indexOf(id)]; }
+
+    /// Returns the element of `id` (undefined if `!hasElement(id)`).
+    const_reference operator[] (ID_t const& id) const
+      { return fData[indexOf(id)]; }
+
+    /// Returns the element of `id`.
+    /// @throw std::out_of_range if `id` is invalid or not in the layout
+    reference at(ID_t const& id) { return fData[checkedIndex(id)]; }
+
+    /// Returns the element of `id`.
+    /// @throw std::out_of_range if `id` is invalid or not in the layout
+    const_reference at(ID_t const& id) const
+      { return fData[checkedIndex(id)]; }
+
+    /// Sets all the elements to a copy of `value`.
+    void fill(T const& value) { fData.assign(fData.size(), value); }
+
+    /// Returns a pointer to the first element.
+    T* data() { return fData.data(); }
+
+    /// Returns a pointer to the first element.
+    T const* data() const { return fData.data(); }
+
+    iterator begin() { return fData.begin(); }
+    iterator end() { return fData.end(); }
+    const_iterator begin() const { return fData.begin(); }
+    const_iterator end() const { return fData.end(); }
+    const_iterator cbegin() const { return fData.cbegin(); }
+    const_iterator cend() const { return fData.cend(); }
+
+  private:
+
+    Layout_t fLayout; ///< Layout of the IDs.
+    std::vector<T> fData; ///< One element per ID, in dense index order.
+
+    /// Returns the dense index of `id`, throwing if not in the layout.
+    std::size_t checkedIndex(ID_t const& id) const;
+
+  }; // class IDcontainer
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Layout of IDs with extents fixed at compile time.
+   * @tparam Extents the extent of each level, top level first
+   *
+   * This is the equivalent of `geo::IDlayout` for detectors whose layout is
+   * known when compiling, e.g. 1 cryostat, 2 TPCs, 3 planes:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * using MyDetectorLayout = geo::StaticIDlayout<1U, 2U, 3U, 4800U>;
+   *
+   * std::size_t const index
+   *   = MyDetectorLayout::index(geo::PlaneID{ 0U, 1U, 2U });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * All methods are `static` and `constexpr`: with the extents being
+   * constants, computing an index reduces to multiplications by constants,
+   * and loops over the levels have constant bounds (`extent()`).
+   * The layout is also available as a `geo::IDlayout` object (`layout()`),
+   * e.g. to construct a `geo::IDcontainer`.
+   */
+  template <std::size_t... Extents>
+  struct StaticIDlayout {
+
+    /// Type of the equivalent layout object.
+    using Layout_t = IDlayout<sizeof...(Extents)>;
+
+    /// Number of levels in the layout.
+    static constexpr std::size_t NLevels = Layout_t::NLevels;
+
+    /// Returns the layout as a `geo::IDlayout` object.
+    static constexpr Layout_t layout() { return { {{ Extents... }} }; }
+
+    /// Returns the extent of the specified level.
+    static constexpr std::size_t extent(std::size_t level)
+      { return layout().extent(level); }
+
+    /// Returns the number of indices for IDs of type `ID`.
+    template <typename ID>
+    static constexpr std::size_t size()
+      { return layout().template size<ID>(); }
+
+    /// Returns the number of indices for IDs with all the levels.
+    static constexpr std::size_t size() { return layout().size(); }
+
+    /// Returns whether `id` is valid and within the extents of the layout.
+    template <typename ID>
+    static constexpr bool contains(ID const& id)
+      { return layout().contains(id); }
+
+    /// Returns the dense index of `id` (undefined if `!contains(id)`).
+    template <typename ID>
+    static constexpr std::size_t index(ID const& id)
+      { return layout().index(id); }
+
+    /// Returns the ID with the specified dense `index`.
+    template <typename ID>
+    static constexpr ID makeID(std::size_t index)
+      { return layout().template makeID<ID>(index); }
+
+  }; // struct StaticIDlayout
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Container with one element per ID of a layout fixed at compile time.
+   * @tparam ID type of ID the elements are indexed by
+   * @tparam T type of the contained elements
+   * @tparam Layout a `geo::StaticIDlayout` with at least as many levels as `ID`
+   *
+   * This is the equivalent of `geo::IDcontainer` for a `geo::StaticIDlayout`:
+   * the elements are in a `std::array`, and the container does not allocate.
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * using MyDetectorLayout = geo::StaticIDlayout<1U, 2U, 3U, 4800U>;
+   *
+   * geo::StaticIDcontainer<geo::PlaneID, float, MyDetectorLayout> gains
+   *   { 1.0f };
+   * gains[geo::PlaneID{ 0U, 1U, 2U }] = 0.98f;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Only the top levels of `Layout` are used, as many as `ID` has.
+   */
+  template <typename ID, typename T, typename Layout>
+  class StaticIDcontainer {
+
+  public:
+
+    using ID_t = ID; ///< Type of ID indexing the elements.
+    using value_type = T; ///< Type of contained element.
+    using Layout_t = Layout; ///< Type of the layout of the IDs.
+
+    /// Number of elements (one per ID in the layout).
+    static constexpr std::size_t Size = Layout_t::template size<ID_t>();
+
+  private:
+    using Data_t = std::array<T, Size>; ///< Type of data storage.
+
+  public:
+
+    using reference = typename Data_t::reference;
+    using const_reference = typename Data_t::const_reference;
+    using iterator = typename Data_t::iterator;
+    using const_iterator = typename Data_t::const_iterator;
+
+    /// Constructor: one value-initialized element per ID in the layout.
+    constexpr StaticIDcontainer() = default;
+
+    /// Constructor: one element per ID in the layout, each a copy of `value`.
+    explicit StaticIDcontainer(T const& value) { fill(value); }
+
+    /// Returns the number of elements (one per ID in the layout).
+    static constexpr std::size_t size() { return Size; }
+
+    /// Returns whether the container has no elements.
+    static constexpr bool empty() { return Size == 0U; }
+
+    /// Returns whether there is an element for `id`.
+    static constexpr bool hasElement(ID_t const& id)
+      { return Layout_t::contains(id); }
+
+    /// Returns the dense index of the element of `id`.
+    static constexpr std::size_t indexOf(ID_t const& id)
+      { return Layout_t::index(id); }
+
+    /// Returns the ID of the element with the specified dense `index`.
+    static constexpr ID_t elementID(std::size_t index)
+      { return Layout_t::template makeID<ID_t>(index); }
+
+    /// Returns the element of `id` (undefined if `!hasElement(id)`).
+    constexpr reference operator[] (ID_t const& id)
+      { return fData[indexOf(id)]; }
+
+    /// Returns the element of `id` (undefined if `!hasElement(id)`).
+    constexpr const_reference operator[] (ID_t const& id) const
+      { return fData[indexOf(id)]; }
+
+    /// Returns the element of `id`.
+    /// @throw std::out_of_range if `id` is invalid or not in the layout
+    reference at(ID_t const& id)
+      { return fData[checkedIndex(id)]; }
+
+    /// Returns the element of `id`.
+    /// @throw std::out_of_range if `id` is invalid or not in the layout
+    const_reference at(ID_t const& id) const
+      { return fData[checkedIndex(id)]; }
+
+    /// Sets all the elements to a copy of `value`.
+    void fill(T const& value) { fData.fill(value); }
+
+    /// Returns a pointer to the first element.
+    constexpr T* data() { return fData.data(); }
+
+    /// Returns a pointer to the first element.
+    constexpr T const* data() const { return fData.data(); }
+
+    constexpr iterator begin() { return fData.begin(); }
+    constexpr iterator end() { return fData.end(); }
+    constexpr const_iterator begin() const { return fData.begin(); }
+    constexpr const_iterator end() const { return fData.end(); }
+    constexpr const_iterator cbegin() const { return fData.cbegin(); }
+    constexpr const_iterator cend() const { return fData.cend(); }
+
+  private:
+
+    Data_t fData {}; ///< One element per ID, in dense index order.
+
+    /// Returns the dense index of `id`, throwing if not in the layout.
+    static std::size_t checkedIndex(ID_t const& id);
+
+  }; // class StaticIDcontainer
+
+
+  // --- BEGIN -- Compressed sparse row tables of IDs --------------------------
+  /**
+   * @name Compressed sparse row tables of IDs
+   *
+   * A compressed sparse row (CSR) table associates to each row, identified by
+   * a dense index (e.g. from `geo::IDlayout::index()` or a channel number), a
+   * sorted list of IDs. All the lists are stored contiguously as packed keys,
+   * with a table of offsets telling where the list of each row starts: the
+   * list of row `i` spans from `offsets[i]` to `offsets[i + 1]`, and
+   * `offsets` has one more element than the number of rows.
+   *
+   * `geo::PackedIDcsrView` reads such a table from memory it does not own
+   * (e.g. a memory-mapped file), while `geo::PackedIDcsr` builds it and owns
+   * it. Lists are returned as `geo::PackedIDspan` objects, which unpack the
+   * IDs on the fly and never allocate.
+   */
+  /// @{
+
+  /// Type of offset in compressed sparse row tables.
+  using CSRoffset_t = std::uint32_t;
+
+
+  /// Non-owning view of a contiguous list of packed IDs, read as `ID`.
+  template <typename ID>
+  class PackedIDspan {
+
+  public:
+
+    using ID_t = ID; ///< Type of ID in the list.
+
+    /// Iterator through the IDs of the list (returned by value).
+    class const_iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = ID_t;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = ID_t;
+
+      constexpr const_iterator() = default;
+      constexpr explicit const_iterator(PackedIDkey_t const* key): fKey(key)
+        {}
+
+      constexpr ID_t operator*() const { return unpackID<ID_t>(*fKey); }
+      constexpr const_iterator& operator++() { ++fKey; return *this; }
+      constexpr const_iterator operator++(int)
+        { const_iterator const old = *this; ++fKey; return old; }
+      constexpr bool operator== (const_iterator const& other) const
+        { return fKey == other.fKey; }
+      constexpr bool operator!= (const_iterator const& other) const
+        { return fKey != other.fKey; }
+
+    private:
+      PackedIDkey_t const* fKey = nullptr;
+    }; // class const_iterator
+
+    /// Constructor: empty list.
+    constexpr PackedIDspan() = default;
+
+    /// Constructor: list of the keys from `begin` to `end` (excluded).
+    constexpr PackedIDspan(PackedIDkey_t const* begin, PackedIDkey_t const* end)
+      : fBegin(begin), fEnd(end) {}
+
+    /// Returns the number of IDs in the list.
+    constexpr std::size_t size() const { return fEnd - fBegin; }
+
+    /// Returns whether the list is empty.
+    constexpr bool empty() const { return fBegin == fEnd; }
+
+    /// Returns the `i`-th ID in the list (undefined if `i >= size()`).
+    constexpr ID_t operator[] (std::size_t i) const
+      { return unpackID<ID_t>(fBegin[i]); }
+
+    /// Returns the first ID in the list (undefined if `empty()`).
+    constexpr ID_t front() const { return (*this)[0U]; }
+
+    /// Returns whether `id` is in the list.
+    constexpr bool contains(ID_t const& id) const;
+
+    constexpr const_iterator begin() const { return const_iterator{ fBegin }; }
+    constexpr const_iterator end() const { return const_iterator{ fEnd }; }
+
+    /// Returns a pointer to the first packed key in the list.
+    constexpr PackedIDkey_t const* keys() const { return fBegin; }
+
+  private:
+
+    PackedIDkey_t const* fBegin = nullptr; ///< First key of the list.
+    PackedIDkey_t const* fEnd = nullptr; ///< Past the last key of the list.
+
+  }; // class PackedIDspan
+
+
+  /// Non-owning view of a compressed sparse row table of `ID` lists.
+  template <typename ID>
+  class PackedIDcsrView {
+
+  public:
+
+    using ID_t = ID; ///< Type of ID in the lists.
+    using Span_t = PackedIDspan<ID_t>; ///< Type of list of IDs of a row.
+
+    /// Constructor: table with no rows.
+    constexpr PackedIDcsrView() = default;
+
+    /**
+     * @brief Constructor: views a table stored elsewhere.
+     * @param offsets start of each row list in `keys`, plus end of the last
+     * @param nRows number of rows (`offsets` has `nRows + 1` elements)
+     * @param keys the packed keys of all the lists, one row after the other
+     *
+     * The data is not copied, and it must stay available as long as this view
+     * and any list from it are used.
+     */
+    constexpr PackedIDcsrView
+      (CSRoffset_t const* offsets, std::size_t nRows, PackedIDkey_t const* keys)
+      : fOffsets(offsets), fNRows(nRows), fKeys(keys) {}
+
+    /// Returns the number of rows.
+    constexpr std::size_t nRows() const { return fNRows; }
+
+    /// Returns the total number of IDs in all the rows.
+    constexpr std::size_t nValues() const
+      { return (fNRows == 0U)? 0U: fOffsets[fNRows]; }
+
+    /// Returns the IDs in the specified `row` (undefined if not `< nRows()`).
+    constexpr Span_t operator[] (std::size_t row) const
+      { return { fKeys + fOffsets[row], fKeys + fOffsets[row + 1U] }; }
+
+    /// Returns the IDs in the specified `row`.
+    /// @throw std::out_of_range if `row` is not smaller than `nRows()`
+    Span_t at(std::size_t row) const;
+
+    /// Returns the table of offsets (`nRows() + 1` elements).
+    constexpr CSRoffset_t const* offsets() const { return fOffsets; }
+
+    /// Returns the packed keys of all the rows (`nValues()` elements).
+    constexpr PackedIDkey_t const* keys() const { return fKeys; }
+
+  private:
+
+    CSRoffset_t const* fOffsets = nullptr; ///< Start of each row.
+    std::size_t fNRows = 0U; ///< Number of rows.
+    PackedIDkey_t const* fKeys = nullptr; ///< Packed keys of all rows.
+
+  }; // class PackedIDcsrView
+
+
+  /**
+   * @brief Compressed sparse row table of `ID` lists, owning its data.
+   * @tparam ID type of ID in the lists
+   *
+   * The table is built once from a list of (row, ID) entries, and it is not
+   * modified afterwards. The IDs of each row are sorted and unique.
+   */
+  template <typename ID>
+  class PackedIDcsr {
+
+  public:
+
+    using ID_t = ID; ///< Type of ID in the lists.
+    using View_t = PackedIDcsrView<ID_t>; ///< Type of non-owning view.
+    using Span_t = typename View_t::Span_t; ///< Type of list of a row.
+
+    /// Type of entry for the construction: row index and ID.
+    using Entry_t = std::pair<std::size_t, ID_t>;
+
+    /// Constructor: table with no rows.
+    PackedIDcsr() = default;
+
+    /**
+     * @brief Constructor: table of `nRows` rows with the specified entries.
+     * @param nRows number of rows in the table
+     * @param entries (row, ID) pairs, in any order
+     * @throw std::out_of_range if the row of an entry is not `< nRows`
+     * @throw std::length_error if there are too many entries for `CSRoffset_t`
+     *
+     * Entries with an invalid ID are ignored, and duplicate entries are kept
+     * only once.
+     */
+    PackedIDcsr(std::size_t nRows, std::vector<Entry_t> const& entries);
+
+    /// Returns a view of this table (valid as long as this object is).
+    View_t view() const
+      { return { fOffsets.data(), fOffsets.size() - 1U, fKeys.data() }; }
+
+    /// Returns the number of rows.
+    std::size_t nRows() const { return fOffsets.size() - 1U; }
+
+    /// Returns the total number of IDs in all the rows.
+    std::size_t nValues() const { return fKeys.size(); }
+
+    /// Returns the IDs in the specified `row` (undefined if not `< nRows()`).
+    Span_t operator[] (std::size_t row) const { return view()[row]; }
+
+    /// Returns the IDs in the specified `row`.
+    /// @throw std::out_of_range if `row` is not smaller than `nRows()`
+    Span_t at(std::size_t row) const { return view().at(row); }
+
+    /// Returns the table of offsets (`nRows() + 1` elements).
+    std::vector<CSRoffset_t> const& offsets() const { return fOffsets; }
+
+    /// Returns the packed keys of all the rows.
+    std::vector<PackedIDkey_t> const& keys() const { return fKeys; }
+
+  private:
+
+    /// Start of each row in `fKeys`, plus the end of the last one.
+    std::vector<CSRoffset_t> fOffsets = std::vector<CSRoffset_t>(1U, 0U);
+
+    std::vector<PackedIDkey_t> fKeys; ///< Packed keys of all the rows.
+
+  }; // class PackedIDcsr
+
+  /// @}
+  // --- END -- Compressed sparse row tables of IDs ----------------------------
+
+
+} // namespace geo
+
+
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+namespace geo::details {
+
+  /// Returns the bit shift of the packed index of `Level`.
+  template <std::size_t Level>
+  constexpr unsigned int packedIndexShift()
+    { return (PackedIDmaxLevels - 1U - Level) * PackedIDindexBits; }
+
+  template <typename ID, std::size_t... L>
+  constexpr PackedIDkey_t packIDimpl
+    (ID const& id, std::index_sequence<L...>)
+  {
+    PackedIDkey_t key = 0U;
+    for (auto const index: { PackedIDkey_t(id.template getIndex<L>())... }) {
+      if (index >= PackedIDinvalidIndex) {
+        throw std::out_of_range("geo::packID(): index "
+          + std::to_string(index) + " of " + std::string(id)
+          + " can't be packed");
+      }
+    }
+    ((key |= PackedIDkey_t(id.template getIndex<L>()) << packedIndexShift<L>()),
+      ...);
+    return key;
+  } // packIDimpl()
+
+  template <typename ID, std::size_t... L>
+  constexpr ID unpackIDimpl(PackedIDkey_t key, std::index_sequence<L...>) {
+    ID id;
+    id.isValid = true;
+    ((id.template writeIndex<L>()
+      = (key >> packedIndexShift<L>()) & PackedIDinvalidIndex), ...);
+    return id;
+  } // unpackIDimpl()
+
+} // namespace geo::details
+
+
+// -----------------------------------------------------------------------------
+template <typename ID>
+constexpr geo::PackedIDkey_t geo::packID(ID const& id) {
+  static_assert(ID::Level < PackedIDmaxLevels, "Too many levels to pack.");
+  if (!id.isValid) return InvalidPackedIDkey;
+  return details::packIDimpl(id, std::make_index_sequence<ID::Level + 1U>{});
+} // geo::packID()
+
+
+// -----------------------------------------------------------------------------
+template <typename ID>
+constexpr ID geo::unpackID(PackedIDkey_t key) {
+  static_assert(ID::Level < PackedIDmaxLevels, "Too many levels to unpack.");
+  if (key == InvalidPackedIDkey) return {};
+  return details::unpackIDimpl<ID>
+    (key, std::make_index_sequence<ID::Level + 1U>{});
+} // geo::unpackID()
+
+
+// -----------------------------------------------------------------------------
+// --- geo::IDlayout
+// ---
+template <std::size_t Levels>
+template <typename ID>
+constexpr std::size_t geo::IDlayout<Levels>::size() const {
+  static_assert(ID::Level < Levels, "ID has more levels than the layout.");
+  return sizeUpTo(ID::Level + 1U);
+} // geo::IDlayout<>::size()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <typename ID>
+constexpr bool geo::IDlayout<Levels>::contains(ID const& id) const {
+  static_assert(ID::Level < Levels, "ID has more levels than the layout.");
+  return id.isValid
+    && containsImpl(id, std::make_index_sequence<ID::Level + 1U>{});
+} // geo::IDlayout<>::contains()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <typename ID>
+constexpr std::size_t geo::IDlayout<Levels>::index(ID const& id) const {
+  static_assert(ID::Level < Levels, "ID has more levels than the layout.");
+  return indexImpl(id, std::make_index_sequence<ID::Level + 1U>{});
+} // geo::IDlayout<>::index()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <typename ID>
+constexpr ID geo::IDlayout<Levels>::makeID(std::size_t index) const {
+  static_assert(ID::Level < Levels, "ID has more levels than the layout.");
+  return makeIDimpl<ID>(index, std::make_index_sequence<ID::Level + 1U>{});
+} // geo::IDlayout<>::makeID()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <std::size_t N>
+constexpr geo::IDlayout<N> geo::IDlayout<Levels>::upperLayout() const {
+  static_assert(N <= Levels, "Not enough levels in the layout.");
+  typename IDlayout<N>::Extents_t extents {};
+  for (std::size_t level = 0U; level < N; ++level)
+    extents[level] = fExtents[level];
+  return { extents };
+} // geo::IDlayout<>::upperLayout()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+constexpr std::size_t geo::IDlayout<Levels>::sizeUpTo
+  (std::size_t nLevels) const
+{
+  std::size_t n = 1U;
+  for (std::size_t level = 0U; level < nLevels; ++level) n *= fExtents[level];
+  return n;
+} // geo::IDlayout<>::sizeUpTo()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <typename ID, std::size_t... L>
+constexpr bool geo::IDlayout<Levels>::containsImpl
+  (ID const& id, std::index_sequence<L...>) const
+{
+  return ((std::size_t(id.template getIndex<L>()) < fExtents[L]) && ...);
+} // geo::IDlayout<>::containsImpl()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <typename ID, std::size_t... L>
+constexpr std::size_t geo::IDlayout<Levels>::indexImpl
+  (ID const& id, std::index_sequence<L...>) const
+{
+  std::size_t index = 0U;
+  ((index = index * fExtents[L] + id.template getIndex<L>()), ...);
+  return index;
+} // geo::IDlayout<>::indexImpl()
+
+
+// -----------------------------------------------------------------------------
+template <std::size_t Levels>
+template <typename ID, std::size_t... L>
+constexpr ID geo::IDlayout<Levels>::makeIDimpl
+  (std::size_t index, std::index_sequence<L...>) const
+{
+  ID id;
+  id.isValid = true;
+  // fill from the deepest level up
+  ((
+    id.template writeIndex<ID::Level - L>() = index % fExtents[ID::Level - L],
+    index /= fExtents[ID::Level - L]
+    ), ...);
+  return id;
+} // geo::IDlayout<>::makeIDimpl()
+
+
+// -----------------------------------------------------------------------------
+// --- geo::IDcontainer
+// ---
+template <typename ID, typename T>
+std::size_t geo::IDcontainer<ID, T>::checkedIndex(ID_t const& id) const {
+  if (!hasElement(id)) {
+    throw std::out_of_range("geo::IDcontainer::at(): "
+      + (id.isValid? std::string(id): std::string("invalid ID"))
+      + " is not in the container");
+  }
+  return indexOf(id);
+} // geo::IDcontainer<>::checkedIndex()
+
+
+// -----------------------------------------------------------------------------
+// --- geo::StaticIDcontainer
+// ---
+template <typename ID, typename T, typename Layout>
+std::size_t geo::StaticIDcontainer<ID, T, Layout>::checkedIndex
+  (ID_t const& id)
+{
+  if (!hasElement(id)) {
+    throw std::out_of_range("geo::StaticIDcontainer::at(): "
+      + (id.isValid? std::string(id): std::string("invalid ID"))
+      + " is not in the container");
+  }
+  return indexOf(id);
+} // geo::StaticIDcontainer<>::checkedIndex()
+
+
+// -----------------------------------------------------------------------------
+// --- geo::PackedIDspan
+// ---
+template <typename ID>
+constexpr bool geo::PackedIDspan<ID>::contains(ID_t const& id) const {
+  if (!id.isValid) return false;
+  PackedIDkey_t const key = packID(id);
+  for (PackedIDkey_t const* k = fBegin; k != fEnd; ++k)
+    if (*k == key) return true;
+  return false;
+} // geo::PackedIDspan<>::contains()
+
+
+// -----------------------------------------------------------------------------
+// --- geo::PackedIDcsrView
+// ---
+template <typename ID>
+auto geo::PackedIDcsrView<ID>::at(std::size_t row) const -> Span_t {
+  if (row >= fNRows) {
+    throw std::out_of_range("geo::PackedIDcsrView::at(): row "
+      + std::to_string(row) + " not in table of " + std::to_string(fNRows)
+      + " rows");
+  }
+  return (*this)[row];
+} // geo::PackedIDcsrView<>::at()
+
+
+// -----------------------------------------------------------------------------
+// --- geo::PackedIDcsr
+// ---
+template <typename ID>
+geo::PackedIDcsr<ID>::PackedIDcsr
+  (std::size_t nRows, std::vector<Entry_t> const& entries)
+{
+  std::vector<std::pair<std::size_t, PackedIDkey_t>> packed;
+  packed.reserve(entries.size());
+  for (auto const& [ row, id ]: entries) {
+    if (row >= nRows) {
+      throw std::out_of_range("geo::PackedIDcsr: entry with row "
+        + std::to_string(row) + " for a table of " + std::to_string(nRows)
+        + " rows");
+    }
+    if (!id.isValid) continue;
+    packed.emplace_back(row, packID(id));
+  } // for
+  std::sort(packed.begin(), packed.end());
+  packed.erase(std::unique(packed.begin(), packed.end()), packed.end());
+
+  if (packed.size() > std::numeric_limits<CSRoffset_t>::max()) {
+    throw std::length_error("geo::PackedIDcsr: "
+      + std::to_string(packed.size()) + " entries are too many");
+  }
+
+  fOffsets.assign(nRows + 1U, 0U);
+  fKeys.reserve(packed.size());
+  for (auto const& [ row, key ]: packed) {
+    ++fOffsets[row + 1U];
+    fKeys.push_back(key);
+  }
+  for (std::size_t row = 0U; row < nRows; ++row)
+    fOffsets[row + 1U] += fOffsets[row];
+
+} // geo::PackedIDcsr<>::PackedIDcsr()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_INDEXING_H
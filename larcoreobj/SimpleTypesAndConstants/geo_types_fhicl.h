@@ -12,6 +12,7 @@
 
 
 // LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 // support libraries
@@ -23,8 +24,14 @@
 #include "fhiclcpp/types/Atom.h"
 
 // C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique(), std::upper_bound(), ...
 #include <vector>
 #include <optional>
+#include <string>
+#include <stdexcept> // std::invalid_argument
+#include <iterator> // std::prev()
+#include <type_traits> // std::decay_t
+#include <utility> // std::declval(), std::move()
 #include <cstddef> // std::size_t
 
 
@@ -418,6 +425,271 @@ namespace geo::fhicl {
   // --- END -- Wire ID --------------------------------------------------------
 
 
+  // --- BEGIN -- ID ranges ----------------------------------------------------
+  /**
+   * @brief Type of ID range configuration structure (requires specialization).
+   * @tparam IDtype type of the ID described by the range
+   *
+   * A range parameter describes all the IDs sharing the same parent ID, with
+   * their deepest index in an inclusive range. The syntax is the same as for
+   * the single ID parameters, except that the deepest index is a sequence of
+   * two values, the first and the last index of the range: for example,
+   * `{ C:0 T:1 P:2 W:[ 100, 4000 ] }` describes the 3901 wires from
+   * `C:0 T:1 P:2 W:100` to `C:0 T:1 P:2 W:4000`, and
+   * `{ C:0 T:1 P:2 W:[ 8, 8 ] }` describes the single wire `C:0 T:1 P:2 W:8`.
+   *
+   * Sequences of ranges are read with `readIDrangeSequence()` (or
+   * `readOptionalIDrangeSequence()`) into a `IDintervals` object, which holds
+   * the sorted and merged list of intervals and never stores each single ID.
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * struct Config {
+   *
+   *   geo::fhicl::WireIDrangeSequence DeadWires {
+   *     fhicl::Name("DeadWires"),
+   *     fhicl::Comment("ranges of wires to be ignored")
+   *     };
+   *
+   * }; // struct Config
+   *
+   * geo::fhicl::IDintervals<geo::WireID> const deadWires
+   *   = geo::fhicl::readIDrangeSequence(config().DeadWires);
+   * if (deadWires.contains(wireID)) return;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * configured e.g. as:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * DeadWires: [
+   *   { C:0 T:1 P:2 W:[ 100, 4000 ] },
+   *   { C:0 T:1 P:2 W:[ 4001, 4100 ] },
+   *   { C:1 T:0 P:0 W:[ 0, 0 ] }
+   *   ]
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Ranges with `isValid: false` are ignored.
+   */
+  template <typename IDtype>
+  struct IDrangeConfig;
+
+  /// Member type of validated ID range parameter.
+  template <typename IDtype>
+  using IDrange = ::fhicl::Table<IDrangeConfig<IDtype>>;
+
+  /// Member type of sequence of ID range parameters.
+  template <typename IDtype>
+  using IDrangeSequence = ::fhicl::Sequence<IDrange<IDtype>>;
+
+  /// Member type of optional sequence of ID range parameters.
+  template <typename IDtype>
+  using OptionalIDrangeSequence = ::fhicl::OptionalSequence<IDrange<IDtype>>;
+
+
+  /// Configuration structure for validated `geo::CryostatID` range parameter.
+  template <>
+  struct IDrangeConfig<geo::CryostatID>: public ValidIDConfig {
+    using ID_t = geo::CryostatID; ///< Type read by this configuration.
+
+    ::fhicl::Sequence<geo::CryostatID::CryostatID_t, 2U> C {
+      ::fhicl::Name("C"),
+      ::fhicl::Comment("first and last cryostat number"),
+      [this](){ return valid(); }
+      };
+
+    ID_t firstID() const { return !valid()? ID_t{}: ID_t{ C(0) }; }
+    ID_t lastID() const { return !valid()? ID_t{}: ID_t{ C(1) }; }
+
+  }; // struct IDrangeConfig<geo::CryostatID>
+
+
+  /// Configuration structure for validated `geo::TPCID` range parameter.
+  template <>
+  struct IDrangeConfig<geo::TPCID>: public IDConfig<geo::CryostatID> {
+    using ID_t = geo::TPCID; ///< Type read by this configuration.
+
+    ::fhicl::Sequence<geo::TPCID::TPCID_t, 2U> T {
+      ::fhicl::Name("T"),
+      ::fhicl::Comment("first and last TPC number within the cryostat"),
+      [this](){ return valid(); }
+      };
+
+    ID_t firstID() const
+      {
+        return !valid()
+          ? ID_t{}: ID_t{ IDConfig<geo::CryostatID>::ID(), T(0) };
+      }
+    ID_t lastID() const
+      {
+        return !valid()
+          ? ID_t{}: ID_t{ IDConfig<geo::CryostatID>::ID(), T(1) };
+      }
+
+  }; // struct IDrangeConfig<geo::TPCID>
+
+
+  /// Configuration structure for validated `geo::OpDetID` range parameter.
+  template <>
+  struct IDrangeConfig<geo::OpDetID>: public IDConfig<geo::CryostatID> {
+    using ID_t = geo::OpDetID; ///< Type read by this configuration.
+
+    ::fhicl::Sequence<geo::OpDetID::OpDetID_t, 2U> O {
+      ::fhicl::Name("O"),
+      ::fhicl::Comment
+        ("first and last optical detector number within the cryostat"),
+      [this](){ return valid(); }
+      };
+
+    ID_t firstID() const
+      {
+        return !valid()
+          ? ID_t{}: ID_t{ IDConfig<geo::CryostatID>::ID(), O(0) };
+      }
+    ID_t lastID() const
+      {
+        return !valid()
+          ? ID_t{}: ID_t{ IDConfig<geo::CryostatID>::ID(), O(1) };
+      }
+
+  }; // struct IDrangeConfig<geo::OpDetID>
+
+
+  /// Configuration structure for validated `geo::PlaneID` range parameter.
+  template <>
+  struct IDrangeConfig<geo::PlaneID>: public IDConfig<geo::TPCID> {
+    using ID_t = geo::PlaneID; ///< Type read by this configuration.
+
+    ::fhicl::Sequence<geo::PlaneID::PlaneID_t, 2U> P {
+      ::fhicl::Name("P"),
+      ::fhicl::Comment("first and last plane number within the TPC"),
+      [this](){ return valid(); }
+      };
+
+    ID_t firstID() const
+      { return !valid()? ID_t{}: ID_t{ IDConfig<geo::TPCID>::ID(), P(0) }; }
+    ID_t lastID() const
+      { return !valid()? ID_t{}: ID_t{ IDConfig<geo::TPCID>::ID(), P(1) }; }
+
+  }; // struct IDrangeConfig<geo::PlaneID>
+
+
+  /// Configuration structure for validated `geo::WireID` range parameter.
+  template <>
+  struct IDrangeConfig<geo::WireID>: public IDConfig<geo::PlaneID> {
+    using ID_t = geo::WireID; ///< Type read by this configuration.
+
+    ::fhicl::Sequence<geo::WireID::WireID_t, 2U> W {
+      ::fhicl::Name("W"),
+      ::fhicl::Comment("first and last wire number within the plane"),
+      [this](){ return valid(); }
+      };
+
+    ID_t firstID() const
+      { return !valid()? ID_t{}: ID_t{ IDConfig<geo::PlaneID>::ID(), W(0) }; }
+    ID_t lastID() const
+      { return !valid()? ID_t{}: ID_t{ IDConfig<geo::PlaneID>::ID(), W(1) }; }
+
+  }; // struct IDrangeConfig<geo::WireID>
+
+
+  /// Member type of sequence of `geo::CryostatID` range parameters.
+  using CryostatIDrangeSequence = IDrangeSequence<geo::CryostatID>;
+
+  /// Member type of optional sequence of `geo::CryostatID` range parameters.
+  using OptionalCryostatIDrangeSequence
+    = OptionalIDrangeSequence<geo::CryostatID>;
+
+  /// Member type of sequence of `geo::TPCID` range parameters.
+  using TPCIDrangeSequence = IDrangeSequence<geo::TPCID>;
+
+  /// Member type of optional sequence of `geo::TPCID` range parameters.
+  using OptionalTPCIDrangeSequence = OptionalIDrangeSequence<geo::TPCID>;
+
+  /// Member type of sequence of `geo::OpDetID` range parameters.
+  using OpDetIDrangeSequence = IDrangeSequence<geo::OpDetID>;
+
+  /// Member type of optional sequence of `geo::OpDetID` range parameters.
+  using OptionalOpDetIDrangeSequence = OptionalIDrangeSequence<geo::OpDetID>;
+
+  /// Member type of sequence of `geo::PlaneID` range parameters.
+  using PlaneIDrangeSequence = IDrangeSequence<geo::PlaneID>;
+
+  /// Member type of optional sequence of `geo::PlaneID` range parameters.
+  using OptionalPlaneIDrangeSequence = OptionalIDrangeSequence<geo::PlaneID>;
+
+  /// Member type of sequence of `geo::WireID` range parameters.
+  using WireIDrangeSequence = IDrangeSequence<geo::WireID>;
+
+  /// Member type of optional sequence of `geo::WireID` range parameters.
+  using OptionalWireIDrangeSequence = OptionalIDrangeSequence<geo::WireID>;
+
+
+  /**
+   * @brief Sorted list of disjoint intervals of IDs.
+   * @tparam IDtype type of the ID
+   *
+   * Each interval includes all the IDs with the same parent ID and deepest
+   * index between the first and the last one (both included).
+   * Overlapping or adjacent intervals are merged at construction, and the
+   * intervals are kept sorted, so that `contains()` is a binary search.
+   */
+  template <typename IDtype>
+  class IDintervals {
+
+  public:
+
+    using ID_t = IDtype; ///< Type of ID in the intervals.
+
+    /// Type of the deepest index of the ID.
+    using Index_t = std::decay_t<decltype(std::declval<ID_t>().deepestIndex())>;
+
+    /// An interval of IDs.
+    struct Interval_t {
+      ID_t first; ///< First ID of the interval.
+      Index_t last; ///< Deepest index of the last ID of the interval.
+
+      /// Returns the last ID of the interval.
+      ID_t lastID() const
+        { ID_t id = first; id.deepestIndex() = last; return id; }
+
+      /// Returns the number of IDs in the interval.
+      std::size_t size() const
+        { return std::size_t(last) - std::size_t(first.deepestIndex()) + 1U; }
+
+    }; // struct Interval_t
+
+    /// Constructor: no IDs.
+    IDintervals() = default;
+
+    /// Constructor: sorts and merges the specified intervals.
+    explicit IDintervals(std::vector<Interval_t> intervals);
+
+    /// Returns whether there are no IDs.
+    bool empty() const { return fIntervals.empty(); }
+
+    /// Returns the number of (disjoint) intervals.
+    std::size_t nIntervals() const { return fIntervals.size(); }
+
+    /// Returns the total number of IDs in all the intervals.
+    std::size_t nIDs() const;
+
+    /// Returns the sorted intervals.
+    std::vector<Interval_t> const& intervals() const { return fIntervals; }
+
+    /// Returns whether `id` is in one of the intervals.
+    bool contains(ID_t const& id) const;
+
+    /// Returns a sorted list of all the IDs in the intervals.
+    std::vector<ID_t> IDs() const;
+
+  private:
+
+    std::vector<Interval_t> fIntervals; ///< Sorted, disjoint intervals.
+
+    /// Returns whether `a` and `b` have the same parent ID.
+    static bool sameParent(ID_t a, ID_t b);
+
+  }; // class IDintervals
+
+  // --- END -- ID ranges ------------------------------------------------------
+
+
   // --- BEGIN -- ID parsing ---------------------------------------------------
 
   //@{
@@ -718,9 +990,211 @@ namespace geo::fhicl {
 
   //@}
 
+  //@{
+  /**
+   * @brief Returns the intervals of IDs from the specified range sequence.
+   * @tparam ID type of the ID read by the FHiCL parameter
+   * @param seq the sequence of ID range parameters to convert
+   * @return the sorted and merged intervals of `ID` in `seq`
+   * @throw std::invalid_argument if a range has the last index before the first
+   * @see `IDrangeConfig`
+   *
+   * Each range is converted into an interval directly: the IDs in the ranges
+   * are never created one by one.
+   */
+  template <typename ID>
+  IDintervals<ID> readIDrangeSequence(IDrangeSequence<ID> const& seq);
+
+  template <typename ID>
+  IDintervals<ID> readParameter(IDrangeSequence<ID> const& seq)
+    { return readIDrangeSequence<ID>(seq); }
+  //@}
+
+  //@{
+  /**
+   * @brief Returns the intervals of IDs from the specified optional range
+   *        sequence.
+   * @tparam ID type of the ID read by the FHiCL parameter
+   * @param seq the optional sequence of ID range parameters to convert
+   * @return the intervals of `ID` in `seq`, or no value if omitted
+   * @throw std::invalid_argument if a range has the last index before the first
+   * @see `readIDrangeSequence()`
+   */
+  template <typename ID>
+  std::optional<IDintervals<ID>> readOptionalIDrangeSequence
+    (OptionalIDrangeSequence<ID> const& seq);
+
+  template <typename ID>
+  std::optional<IDintervals<ID>> readParameter
+    (OptionalIDrangeSequence<ID> const& seq)
+    { return readOptionalIDrangeSequence<ID>(seq); }
+  //@}
+
   // --- END -- ID parsing -----------------------------------------------------
 
 
+  // --- BEGIN -- Bulk ID sequence parsing -------------------------------------
+  /**
+   * @name Bulk reading of ID sequences
+   *
+   * These functions read a sequence of IDs directly into a representation
+   * suitable for fast lookup, converting each ID as it is read and allocating
+   * the result only once:
+   * * `readSortedIDsequence()` returns a sorted STL vector of IDs without
+   *   duplicates, to be searched with `std::binary_search()`;
+   * * `readPackedIDsequence()` returns a sorted vector of packed ID keys
+   *   (`geo::PackedIDkey_t`, see `geo::packID()`) without duplicates;
+   * * `readIDsequenceBits()` returns a vector of flags, one for each dense
+   *   index of the specified `layout` (e.g. a `geo::IDlayout`), set for the
+   *   IDs in the sequence.
+   *
+   * Invalid IDs (`isValid: false`) are skipped.
+   * Each function has a version for optional sequences, returning no value if
+   * the sequence was omitted.
+   * For example, a list of wires to skip might be read as:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::IDlayout<4U> const layout {{ 1U, 2U, 3U, 5000U }};
+   * std::vector<bool> const skipWire
+   *   = geo::fhicl::readIDsequenceBits(config().SkipWires, layout);
+   *
+   * // ...
+   *
+   * if (skipWire[layout.index(wireID)]) continue;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  /// @{
+
+  /// Returns the IDs in the sequence, sorted and without duplicates.
+  template <typename SrcID, typename ID = SrcID>
+  std::vector<ID> readSortedIDsequence(IDsequence<SrcID> const& seq);
+
+  /// Returns the IDs in the sequence, sorted and without duplicates.
+  template <typename SrcID, typename ID = SrcID>
+  std::optional<std::vector<ID>> readOptionalSortedIDsequence
+    (OptionalIDsequence<SrcID> const& seq);
+
+  /**
+   * @brief Returns the packed keys of the IDs in the sequence.
+   * @return the packed keys, sorted and without duplicates
+   * @throw std::out_of_range if an ID can't be packed (see `geo::packID()`)
+   */
+  template <typename SrcID>
+  std::vector<geo::PackedIDkey_t> readPackedIDsequence
+    (IDsequence<SrcID> const& seq);
+
+  /// Returns the packed keys of the IDs in the sequence.
+  /// @see `readPackedIDsequence()`
+  template <typename SrcID>
+  std::optional<std::vector<geo::PackedIDkey_t>> readOptionalPackedIDsequence
+    (OptionalIDsequence<SrcID> const& seq);
+
+  /**
+   * @brief Returns a flag per dense index of `layout`, set for IDs in `seq`.
+   * @tparam Layout type of ID layout (like `geo::IDlayout`)
+   * @param seq the sequence of ID parameters to convert
+   * @param layout the layout assigning a dense index to each ID
+   * @return a vector with `layout.template size<SrcID>()` flags
+   * @throw std::out_of_range if an ID is not in `layout`
+   */
+  template <typename SrcID, typename Layout>
+  std::vector<bool> readIDsequenceBits
+    (IDsequence<SrcID> const& seq, Layout const& layout);
+
+  /// Returns a flag per dense index of `layout`, set for IDs in `seq`.
+  /// @see `readIDsequenceBits()`
+  template <typename SrcID, typename Layout>
+  std::optional<std::vector<bool>> readOptionalIDsequenceBits
+    (OptionalIDsequence<SrcID> const& seq, Layout const& layout);
+
+  /// @}
+  // --- END -- Bulk ID sequence parsing ---------------------------------------
+
+
+  // --- BEGIN -- Validated ID parsing -----------------------------------------
+  /**
+   * @name Reading IDs validated against detector extents
+   *
+   * These functions read ID parameters and check at configuration time that
+   * each ID is valid and within the extents of the specified `layout` (e.g.
+   * a `geo::IDlayout`), throwing `std::out_of_range` otherwise.
+   * Together with each ID they return its dense index in the layout, so that
+   * code using them can index dense per-element data directly, without
+   * further checks:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::IDlayout<4U> const layout {{ nCryostats, nTPCs, nPlanes, nWires }};
+   * geo::fhicl::IndexedIDs<geo::WireID> const wires
+   *   = geo::fhicl::readValidatedIDsequence(config().Wires, layout);
+   *
+   * for (std::size_t const index: wires.indices) ++wireCounts[index];
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Sequences keep the order and the duplicates of the configuration.
+   */
+  /// @{
+
+  /// An ID with its dense index.
+  template <typename ID>
+  struct IndexedID {
+    ID id; ///< The ID.
+    std::size_t index; ///< Dense index of the ID in its layout.
+  }; // struct IndexedID
+
+  /// A list of IDs with their dense indices.
+  template <typename ID>
+  struct IndexedIDs {
+    std::vector<ID> IDs; ///< The IDs.
+    std::vector<std::size_t> indices; ///< Dense index of each of the IDs.
+
+    /// Returns the number of IDs.
+    std::size_t size() const { return IDs.size(); }
+
+    /// Returns whether there are no IDs.
+    bool empty() const { return IDs.empty(); }
+
+    /// Returns the ID and index number `i`.
+    IndexedID<ID> operator[] (std::size_t i) const
+      { return { IDs[i], indices[i] }; }
+
+  }; // struct IndexedIDs
+
+
+  /**
+   * @brief Returns the ID from the parameter and its dense index in `layout`.
+   * @throw std::out_of_range if the ID is invalid or not in `layout`
+   */
+  template <typename SrcID, typename Layout>
+  IndexedID<SrcID> readValidatedID
+    (IDparameter<SrcID> const& atom, Layout const& layout);
+
+  /**
+   * @brief Returns the ID from the optional parameter and its dense index.
+   * @return the ID and its index in `layout`, or no value if omitted
+   * @throw std::out_of_range if the ID is invalid or not in `layout`
+   */
+  template <typename SrcID, typename Layout>
+  std::optional<IndexedID<SrcID>> readOptionalValidatedID
+    (OptionalID<SrcID> const& atom, Layout const& layout);
+
+  /**
+   * @brief Returns the IDs from the sequence and their dense indices.
+   * @throw std::out_of_range if any ID is invalid or not in `layout`
+   */
+  template <typename SrcID, typename Layout>
+  IndexedIDs<SrcID> readValidatedIDsequence
+    (IDsequence<SrcID> const& seq, Layout const& layout);
+
+  /**
+   * @brief Returns the IDs from the optional sequence and their dense indices.
+   * @return the IDs and their indices in `layout`, or no value if omitted
+   * @throw std::out_of_range if any ID is invalid or not in `layout`
+   */
+  template <typename SrcID, typename Layout>
+  std::optional<IndexedIDs<SrcID>> readOptionalValidatedIDsequence
+    (OptionalIDsequence<SrcID> const& seq, Layout const& layout);
+
+  /// @}
+  // --- END -- Validated ID parsing -------------------------------------------
+
+
   /// @}
   // --- END -- Validated configuration parameters for geometry ID objects -----
 
@@ -857,6 +1331,341 @@ std::vector<ID> geo::fhicl::readOptionalIDsequence
 } // geo::fhicl::readOptionalIDsequence(std::vector const&)
 
 
+// -----------------------------------------------------------------------------
+// --- geo::fhicl::IDintervals
+// ---
+template <typename IDtype>
+geo::fhicl::IDintervals<IDtype>::IDintervals(std::vector<Interval_t> intervals)
+{
+  std::sort(intervals.begin(), intervals.end(),
+    [](Interval_t const& a, Interval_t const& b){ return a.first < b.first; });
+
+  fIntervals.reserve(intervals.size());
+  for (Interval_t const& interval: intervals) {
+    if (!fIntervals.empty()) {
+      Interval_t& current = fIntervals.back();
+      // in `std::size_t` so that `last + 1` can't wrap (`last` may be the
+      // largest index)
+      if (sameParent(current.first, interval.first)
+        && (std::size_t(interval.first.deepestIndex())
+          <= std::size_t(current.last) + 1U)
+      ) {
+        current.last = std::max(current.last, interval.last);
+        continue;
+      }
+    }
+    fIntervals.push_back(interval);
+  } // for
+  fIntervals.shrink_to_fit();
+
+} // geo::fhicl::IDintervals<>::IDintervals()
+
+
+// -----------------------------------------------------------------------------
+template <typename IDtype>
+std::size_t geo::fhicl::IDintervals<IDtype>::nIDs() const {
+  std::size_t n = 0U;
+  for (Interval_t const& interval: fIntervals) n += interval.size();
+  return n;
+} // geo::fhicl::IDintervals<>::nIDs()
+
+
+// -----------------------------------------------------------------------------
+template <typename IDtype>
+bool geo::fhicl::IDintervals<IDtype>::contains(ID_t const& id) const {
+  // find the first interval starting after `id`; the previous one may have it
+  auto const it = std::upper_bound(fIntervals.begin(), fIntervals.end(), id,
+    [](ID_t const& id, Interval_t const& interval)
+      { return id < interval.first; }
+    );
+  if (it == fIntervals.begin()) return false;
+  Interval_t const& candidate = *std::prev(it);
+  return sameParent(candidate.first, id)
+    && (id.deepestIndex() <= candidate.last);
+} // geo::fhicl::IDintervals<>::contains()
+
+
+// -----------------------------------------------------------------------------
+template <typename IDtype>
+auto geo::fhicl::IDintervals<IDtype>::IDs() const -> std::vector<ID_t> {
+  std::vector<ID_t> IDs;
+  IDs.reserve(nIDs());
+  for (Interval_t const& interval: fIntervals) {
+    // stops at `last` without incrementing past it (it may be the largest)
+    ID_t id = interval.first;
+    while (true) {
+      IDs.push_back(id);
+      if (id.deepestIndex() == interval.last) break;
+      ++id.deepestIndex();
+    }
+  } // for
+  return IDs;
+} // geo::fhicl::IDintervals<>::IDs()
+
+
+// -----------------------------------------------------------------------------
+template <typename IDtype>
+bool geo::fhicl::IDintervals<IDtype>::sameParent(ID_t a, ID_t b) {
+  a.deepestIndex() = 0U;
+  b.deepestIndex() = 0U;
+  return a == b;
+} // geo::fhicl::IDintervals<>::sameParent()
+
+
+// -----------------------------------------------------------------------------
+namespace geo::fhicl::details {
+
+  /**
+   * @brief Returns the intervals of the valid ranges in `ranges`.
+   * @param ranges the whole collection of range configurations (`seq()`)
+   * @param caller name of the calling function, for error messages
+   * @throw std::invalid_argument if a range ends before its start
+   */
+  template <typename ID, typename Configs>
+  IDintervals<ID> IDintervalsFrom(Configs const& ranges, char const* caller) {
+    using Interval_t = typename IDintervals<ID>::Interval_t;
+
+    std::vector<Interval_t> intervals;
+    intervals.reserve(ranges.size());
+    for (std::size_t i = 0; i < ranges.size(); ++i) {
+      auto const& range = ranges[i]; // an `IDrangeConfig`
+      if (!range.valid()) continue;
+      ID const first = range.firstID();
+      ID const last = range.lastID();
+      if (last.deepestIndex() < first.deepestIndex()) {
+        throw std::invalid_argument(std::string(caller) + "(): range #"
+          + std::to_string(i) + " of " + std::string(first) + " ends at "
+          + std::to_string(last.deepestIndex()) + ", before its start");
+      }
+      intervals.push_back({ first, last.deepestIndex() });
+    } // for
+    return IDintervals<ID>{ std::move(intervals) };
+  } // IDintervalsFrom()
+
+} // namespace geo::fhicl::details
+
+
+// -----------------------------------------------------------------------------
+template <typename ID>
+geo::fhicl::IDintervals<ID> geo::fhicl::readIDrangeSequence
+  (IDrangeSequence<ID> const& seq)
+{
+  return details::IDintervalsFrom<ID>
+    (seq(), "geo::fhicl::readIDrangeSequence");
+} // geo::fhicl::readIDrangeSequence()
+
+
+// -----------------------------------------------------------------------------
+template <typename ID>
+std::optional<geo::fhicl::IDintervals<ID>>
+geo::fhicl::readOptionalIDrangeSequence(OptionalIDrangeSequence<ID> const& seq)
+{
+  typename OptionalIDrangeSequence<ID>::value_type ranges;
+  if (!seq(ranges)) return std::nullopt;
+  return details::IDintervalsFrom<ID>
+    (ranges, "geo::fhicl::readOptionalIDrangeSequence");
+} // geo::fhicl::readOptionalIDrangeSequence()
+
+
+// -----------------------------------------------------------------------------
+// --- bulk ID sequence parsing
+// ---
+namespace geo::fhicl::details {
+
+  // All these functions take the whole collection of configurations, as
+  // returned by `seq()`: `seq(i)` would return a copy of a configuration table
+  // on each call.
+
+  /// Returns the valid IDs from `configs`, sorted and unique.
+  template <typename ID, typename Configs>
+  std::vector<ID> sortedIDs(Configs const& configs) {
+    std::vector<ID> IDs;
+    IDs.reserve(configs.size());
+    for (auto const& config: configs)
+      if (config.valid()) IDs.push_back(config.ID());
+    std::sort(IDs.begin(), IDs.end());
+    IDs.erase(std::unique(IDs.begin(), IDs.end()), IDs.end());
+    return IDs;
+  } // sortedIDs()
+
+
+  /// Returns the packed keys of valid IDs from `configs`.
+  template <typename Configs>
+  std::vector<geo::PackedIDkey_t> packedIDs(Configs const& configs) {
+    std::vector<geo::PackedIDkey_t> keys;
+    keys.reserve(configs.size());
+    for (auto const& config: configs)
+      if (config.valid()) keys.push_back(geo::packID(config.ID()));
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+  } // packedIDs()
+
+
+  /// Returns flags for the dense indices of valid IDs from `configs`.
+  template <typename ID, typename Layout, typename Configs>
+  std::vector<bool> IDbits(Configs const& configs, Layout const& layout) {
+    std::vector<bool> bits(layout.template size<ID>(), false);
+    for (auto const& config: configs) {
+      if (!config.valid()) continue;
+      ID const id = config.ID();
+      if (!layout.contains(id)) {
+        throw std::out_of_range("geo::fhicl::readIDsequenceBits(): "
+          + std::string(id) + " is not in the layout");
+      }
+      bits[layout.index(id)] = true;
+    } // for
+    return bits;
+  } // IDbits()
+
+} // namespace geo::fhicl::details
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename ID /* = SrcID */>
+std::vector<ID> geo::fhicl::readSortedIDsequence(IDsequence<SrcID> const& seq)
+{
+  return details::sortedIDs<ID>(seq());
+} // geo::fhicl::readSortedIDsequence()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename ID /* = SrcID */>
+std::optional<std::vector<ID>> geo::fhicl::readOptionalSortedIDsequence
+  (OptionalIDsequence<SrcID> const& seq)
+{
+  typename OptionalIDsequence<SrcID>::value_type values;
+  if (!seq(values)) return std::nullopt;
+  return details::sortedIDs<ID>(values);
+} // geo::fhicl::readOptionalSortedIDsequence()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID>
+std::vector<geo::PackedIDkey_t> geo::fhicl::readPackedIDsequence
+  (IDsequence<SrcID> const& seq)
+{
+  return details::packedIDs(seq());
+} // geo::fhicl::readPackedIDsequence()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID>
+std::optional<std::vector<geo::PackedIDkey_t>>
+geo::fhicl::readOptionalPackedIDsequence(OptionalIDsequence<SrcID> const& seq)
+{
+  typename OptionalIDsequence<SrcID>::value_type values;
+  if (!seq(values)) return std::nullopt;
+  return details::packedIDs(values);
+} // geo::fhicl::readOptionalPackedIDsequence()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Layout>
+std::vector<bool> geo::fhicl::readIDsequenceBits
+  (IDsequence<SrcID> const& seq, Layout const& layout)
+{
+  return details::IDbits<SrcID>(seq(), layout);
+} // geo::fhicl::readIDsequenceBits()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Layout>
+std::optional<std::vector<bool>> geo::fhicl::readOptionalIDsequenceBits
+  (OptionalIDsequence<SrcID> const& seq, Layout const& layout)
+{
+  typename OptionalIDsequence<SrcID>::value_type values;
+  if (!seq(values)) return std::nullopt;
+  return details::IDbits<SrcID>(values, layout);
+} // geo::fhicl::readOptionalIDsequenceBits()
+
+
+// -----------------------------------------------------------------------------
+// --- validated ID parsing
+// ---
+namespace geo::fhicl::details {
+
+  /// Returns the dense index of `id` in `layout`, throws if not there.
+  template <typename ID, typename Layout>
+  std::size_t validatedIndex
+    (ID const& id, Layout const& layout, std::string const& paramName)
+  {
+    if (!id.isValid) {
+      throw std::out_of_range("geo::fhicl: parameter '" + paramName
+        + "' has an invalid ID");
+    }
+    if (!layout.contains(id)) {
+      throw std::out_of_range("geo::fhicl: parameter '" + paramName
+        + "' has ID " + std::string(id) + " outside of the detector extents");
+    }
+    return layout.index(id);
+  } // validatedIndex()
+
+
+  /// Returns the IDs from `configs` with their dense indices.
+  template <typename ID, typename Layout, typename Configs>
+  IndexedIDs<ID> indexedIDs(
+    Configs const& configs, Layout const& layout, std::string const& paramName
+  ) {
+    IndexedIDs<ID> IDs;
+    IDs.IDs.reserve(configs.size());
+    IDs.indices.reserve(configs.size());
+    for (std::size_t i = 0; i < configs.size(); ++i) {
+      ID const id = configs[i].ID();
+      IDs.indices.push_back(validatedIndex
+        (id, layout, paramName + "[" + std::to_string(i) + "]"));
+      IDs.IDs.push_back(id);
+    } // for
+    return IDs;
+  } // indexedIDs()
+
+} // namespace geo::fhicl::details
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Layout>
+geo::fhicl::IndexedID<SrcID> geo::fhicl::readValidatedID
+  (IDparameter<SrcID> const& atom, Layout const& layout)
+{
+  SrcID const id = readID(atom);
+  return { id, details::validatedIndex(id, layout, atom.name()) };
+} // geo::fhicl::readValidatedID()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Layout>
+std::optional<geo::fhicl::IndexedID<SrcID>>
+geo::fhicl::readOptionalValidatedID
+  (OptionalID<SrcID> const& atom, Layout const& layout)
+{
+  std::optional<SrcID> const id = readOptionalID(atom);
+  if (!id) return std::nullopt;
+  return IndexedID<SrcID>
+    { *id, details::validatedIndex(*id, layout, atom.name()) };
+} // geo::fhicl::readOptionalValidatedID()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Layout>
+geo::fhicl::IndexedIDs<SrcID> geo::fhicl::readValidatedIDsequence
+  (IDsequence<SrcID> const& seq, Layout const& layout)
+{
+  return details::indexedIDs<SrcID>(seq(), layout, seq.name());
+} // geo::fhicl::readValidatedIDsequence()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Layout>
+std::optional<geo::fhicl::IndexedIDs<SrcID>>
+geo::fhicl::readOptionalValidatedIDsequence
+  (OptionalIDsequence<SrcID> const& seq, Layout const& layout)
+{
+  typename OptionalIDsequence<SrcID>::value_type values;
+  if (!seq(values)) return std::nullopt;
+  return details::indexedIDs<SrcID>(values, layout, seq.name());
+} // geo::fhicl::readOptionalValidatedIDsequence()
+
+
 // -----------------------------------------------------------------------------
 
 
@@ -21,6 +21,10 @@
 #include "Math/GenVector/DisplacementVector3D.h"
 #include "Math/GenVector/Rotation3D.h"
 
+// C/C++ standard libraries
+#include <iterator> // std::begin(), std::end()
+#include <vector>
+
 
 // BEGIN -- GENVECTOR_CONSTEXPR issue ------------------------------------------
 /**
@@ -229,6 +233,183 @@ namespace geo {
   /// @}
 
 
+  //----------------------------------------------------------------------------
+  /**
+   * @name Local coordinate system tags.
+   *
+   * Tags for the reference frames local to the main TPC geometry elements.
+   * Like for `geo::OpticalLocalCoordinateSystemTag`, vectors with the same tag
+   * are compatible only if they are local to the same object: the tags only
+   * prevent mixing them with vectors of a different kind of frame.
+   */
+  /// @{
+
+  /// The tag defining the reference frame local to a TPC.
+  struct TPCLocalCoordinateSystemTag {};
+
+  /// The tag defining the reference frame local to a wire plane.
+  struct PlaneLocalCoordinateSystemTag {};
+
+  /// The tag defining the reference frame local to a wire.
+  struct WireLocalCoordinateSystemTag {};
+
+  /// @}
+
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Rigid transformation between two tagged reference frames.
+   * @tparam SrcTag coordinate system tag of the source frame
+   * @tparam DestTag coordinate system tag of the destination frame
+   *
+   * A point @f$ \vec{p} @f$ in the source frame is transformed into
+   * @f$ R \vec{p} + \vec{t} @f$ in the destination frame, where @f$ R @f$ is
+   * the rotation and @f$ \vec{t} @f$ the translation of the transformation.
+   * Displacement vectors are only rotated.
+   *
+   * The frames are part of the type: the transformation accepts only points
+   * and vectors tagged with `SrcTag` and returns them tagged with `DestTag`,
+   * and two transformations can be chained (`operator*`) only if the
+   * destination frame of the first one is the source frame of the second one.
+   * Mismatches are compilation errors.
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * using PlaneToTPC_t = geo::FrameTransformation
+   *   <geo::PlaneLocalCoordinateSystemTag, geo::TPCLocalCoordinateSystemTag>;
+   * using TPCToWorld_t = geo::FrameTransformation
+   *   <geo::TPCLocalCoordinateSystemTag, geo::GlobalCoords>;
+   *
+   * geo::FrameTransformation<geo::PlaneLocalCoordinateSystemTag, geo::GlobalCoords>
+   *   const planeToWorld = tpcToWorld * planeToTPC;
+   *
+   * std::vector<geo::Point_t> worldPoints(localPoints.size());
+   * planeToWorld.transformPoints
+   *   (localPoints.begin(), localPoints.end(), worldPoints.begin());
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * Applying the transformation to collections of points
+   * (`transformPoints()`, `transformVectors()`) is a sequence of multiply-adds
+   * on the rotation matrix, with no intermediate objects.
+   */
+  template <typename SrcTag, typename DestTag>
+  class FrameTransformation {
+
+  public:
+
+    using SourceTag_t = SrcTag; ///< Tag of the source reference frame.
+    using DestinationTag_t = DestTag; ///< Tag of the destination frame.
+
+    using SourcePoint_t = PointIn_t<SrcTag>; ///< Point in source frame.
+    using SourceVector_t = VectorIn_t<SrcTag>; ///< Vector in source frame.
+    using DestPoint_t = PointIn_t<DestTag>; ///< Point in destination frame.
+    using DestVector_t = VectorIn_t<DestTag>; ///< Vector in destination frame.
+
+    /// Type of the inverse transformation.
+    using Inverse_t = FrameTransformation<DestTag, SrcTag>;
+
+    /// Default constructor: identity transformation.
+    FrameTransformation()
+      : FrameTransformation(Rotation_t{}, DestVector_t{ 0.0, 0.0, 0.0 }) {}
+
+    /// Constructor: rotation `rotation` followed by translation `translation`.
+    FrameTransformation
+      (Rotation_t const& rotation, DestVector_t const& translation);
+
+    /// Constructor: pure rotation.
+    explicit FrameTransformation(Rotation_t const& rotation)
+      : FrameTransformation(rotation, DestVector_t{ 0.0, 0.0, 0.0 }) {}
+
+    /// Constructor: pure translation.
+    explicit FrameTransformation(DestVector_t const& translation)
+      : FrameTransformation(Rotation_t{}, translation) {}
+
+
+    /// Returns the rotation part of the transformation.
+    Rotation_t const& rotation() const { return fRotation; }
+
+    /// Returns the translation part of the transformation.
+    DestVector_t const& translation() const { return fTranslation; }
+
+
+    /// @{
+    /// @name Transformation of single objects
+
+    /// Returns the point `p` transformed into the destination frame.
+    DestPoint_t operator() (SourcePoint_t const& p) const
+      { return transformPoint(p); }
+
+    /// Returns the vector `v` rotated into the destination frame.
+    DestVector_t operator() (SourceVector_t const& v) const
+      { return transformVector(v); }
+
+    /// Returns the point `p` transformed into the destination frame.
+    DestPoint_t transformPoint(SourcePoint_t const& p) const;
+
+    /// Returns the vector `v` rotated into the destination frame.
+    DestVector_t transformVector(SourceVector_t const& v) const;
+
+    /// @}
+
+
+    /// @{
+    /**
+     * @name Transformation of collections
+     *
+     * These functions follow the pattern of `std::transform()`: the points
+     * (or vectors) in the range from `begin` to `end` are transformed and
+     * written in sequence starting from `dest`, and the iterator past the
+     * last written element is returned.
+     * The source elements must be `SourcePoint_t` (`SourceVector_t`) and the
+     * destination must accept `DestPoint_t` (`DestVector_t`).
+     */
+
+    /// Transforms all points from `begin` to `end` into `dest`.
+    template <typename InIter, typename OutIter>
+    OutIter transformPoints(InIter begin, InIter end, OutIter dest) const;
+
+    /// Rotates all vectors from `begin` to `end` into `dest`.
+    template <typename InIter, typename OutIter>
+    OutIter transformVectors(InIter begin, InIter end, OutIter dest) const;
+
+    /// Transforms all points in `points` into a new collection.
+    template <typename Coll>
+    std::vector<DestPoint_t> transformPoints(Coll const& points) const;
+
+    /// Rotates all vectors in `vectors` into a new collection.
+    template <typename Coll>
+    std::vector<DestVector_t> transformVectors(Coll const& vectors) const;
+
+    /// @}
+
+
+    /// Returns the transformation from destination to source frame.
+    Inverse_t inverse() const;
+
+  private:
+    Rotation_t fRotation; ///< Rotation part.
+    DestVector_t fTranslation; ///< Translation part.
+
+    /// Applies the rotation to the specified coordinates.
+    template <typename Vect>
+    Vect rotate(double x, double y, double z) const;
+
+  }; // class FrameTransformation<>
+
+
+  /**
+   * @brief Returns the composition of two transformations.
+   * @param second the transformation applied last
+   * @param first the transformation applied first
+   * @return a transformation equivalent to applying `first` then `second`
+   *
+   * The destination frame of `first` must be the source of `second`.
+   */
+  template <typename SrcTag, typename MidTag, typename DestTag>
+  FrameTransformation<SrcTag, DestTag> operator*(
+    FrameTransformation<MidTag, DestTag> const& second,
+    FrameTransformation<SrcTag, MidTag> const& first
+    );
+
+
   //----------------------------------------------------------------------------
 
 } // namespace geo
@@ -236,4 +417,116 @@ namespace geo {
 // END Geometry group ----------------------------------------------------------
 
 
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+geo::FrameTransformation<SrcTag, DestTag>::FrameTransformation
+  (Rotation_t const& rotation, DestVector_t const& translation)
+  : fRotation(rotation), fTranslation(translation)
+  {}
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+template <typename Vect>
+Vect geo::FrameTransformation<SrcTag, DestTag>::rotate
+  (double x, double y, double z) const
+{
+  // the rotation preserves the frame tag, which is replaced afterwards
+  Vector_t const r = fRotation(Vector_t{ x, y, z });
+  return { r.X(), r.Y(), r.Z() };
+} // geo::FrameTransformation<>::rotate()
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+auto geo::FrameTransformation<SrcTag, DestTag>::transformPoint
+  (SourcePoint_t const& p) const -> DestPoint_t
+{
+  DestVector_t const r = rotate<DestVector_t>(p.X(), p.Y(), p.Z());
+  return {
+    r.X() + fTranslation.X(),
+    r.Y() + fTranslation.Y(),
+    r.Z() + fTranslation.Z()
+    };
+} // geo::FrameTransformation<>::transformPoint()
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+auto geo::FrameTransformation<SrcTag, DestTag>::transformVector
+  (SourceVector_t const& v) const -> DestVector_t
+  { return rotate<DestVector_t>(v.X(), v.Y(), v.Z()); }
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+template <typename InIter, typename OutIter>
+OutIter geo::FrameTransformation<SrcTag, DestTag>::transformPoints
+  (InIter begin, InIter end, OutIter dest) const
+{
+  while (begin != end) *dest++ = transformPoint(*begin++);
+  return dest;
+} // geo::FrameTransformation<>::transformPoints()
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+template <typename InIter, typename OutIter>
+OutIter geo::FrameTransformation<SrcTag, DestTag>::transformVectors
+  (InIter begin, InIter end, OutIter dest) const
+{
+  while (begin != end) *dest++ = transformVector(*begin++);
+  return dest;
+} // geo::FrameTransformation<>::transformVectors()
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+template <typename Coll>
+auto geo::FrameTransformation<SrcTag, DestTag>::transformPoints
+  (Coll const& points) const -> std::vector<DestPoint_t>
+{
+  std::vector<DestPoint_t> transformed(points.size());
+  transformPoints(std::begin(points), std::end(points), transformed.begin());
+  return transformed;
+} // geo::FrameTransformation<>::transformPoints(Coll)
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+template <typename Coll>
+auto geo::FrameTransformation<SrcTag, DestTag>::transformVectors
+  (Coll const& vectors) const -> std::vector<DestVector_t>
+{
+  std::vector<DestVector_t> transformed(vectors.size());
+  transformVectors(std::begin(vectors), std::end(vectors), transformed.begin());
+  return transformed;
+} // geo::FrameTransformation<>::transformVectors(Coll)
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename DestTag>
+auto geo::FrameTransformation<SrcTag, DestTag>::inverse() const -> Inverse_t {
+  using InvTranslation_t = typename Inverse_t::DestVector_t;
+  Rotation_t const invRotation = fRotation.Inverse();
+  DestVector_t const t = invRotation(fTranslation);
+  return { invRotation, InvTranslation_t{ -t.X(), -t.Y(), -t.Z() } };
+} // geo::FrameTransformation<>::inverse()
+
+
+//------------------------------------------------------------------------------
+template <typename SrcTag, typename MidTag, typename DestTag>
+geo::FrameTransformation<SrcTag, DestTag> geo::operator*(
+  FrameTransformation<MidTag, DestTag> const& second,
+  FrameTransformation<SrcTag, MidTag> const& first
+) {
+  // R2 (R1 p + t1) + t2 = (R2 R1) p + (R2 t1 + t2)
+  auto const t
+    = second.transformVector(first.translation()) + second.translation();
+  return { second.rotation() * first.rotation(), t };
+} // geo::operator*(FrameTransformation)
+
+
 #endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTORS_H
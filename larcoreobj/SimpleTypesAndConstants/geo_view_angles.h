@@ -0,0 +1,208 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_view_angles.h
+ * @brief  Cache of the trigonometric functions of the wire angle of each view.
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_types.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VIEW_ANGLES_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VIEW_ANGLES_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h" // geo::View_t
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <vector>
+#include <utility> // std::pair
+#include <initializer_list>
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <string>
+#include <cmath> // std::cos(), std::sin()
+#include <cstddef> // std::size_t
+
+
+namespace geo {
+
+  /**
+   * @brief Table of cosine and sine of the angle of each view.
+   * @ingroup Geometry
+   *
+   * The projection of a point on the direction measured by the wires of a
+   * plane requires the cosine and sine of the angle of that direction, which
+   * is the same for all the planes of a view. This table computes them once
+   * for each view (`geo::View_t`), so that the projection of a point with
+   * coordinates @f$ (a, b) @f$ on the plane becomes
+   * @f$ a \cos\vartheta + b \sin\vartheta @f$, two multiplications and an
+   * addition. Here @f$ \vartheta @f$ is the angle of the measured direction
+   * from the axis of the first coordinate; which are the two coordinates
+   * (e.g. @f$ z @f$ and @f$ y @f$) is a convention of the caller.
+   *
+   * Angles are in radians. Views which share the same value (like `geo::kW`
+   * and `geo::kZ`) share the same entry.
+   *
+   * Example:
+   * @code
+   * geo::ViewAngleTable const angles {
+   *   { geo::kU, util::DegreesToRadians(+60.0) },
+   *   { geo::kV, util::DegreesToRadians(-60.0) },
+   *   { geo::kW, 0.0 }
+   * };
+   * double const u = angles.project(geo::kU, z, y);
+   * @endcode
+   *
+   * The table is not modified after set up, and it is safe to share it among
+   * threads as long as no angle is set while in use.
+   */
+  class ViewAngleTable {
+
+  public:
+
+    /// Number of views the table has room for.
+    static constexpr std::size_t NViews = static_cast<std::size_t>(k3D);
+
+    /// Cosine and sine of the angle of a view.
+    struct Direction_t {
+      double cos = 1.0; ///< Cosine of the angle.
+      double sin = 0.0; ///< Sine of the angle.
+    }; // struct Direction_t
+
+    /// Constructor: no view is defined.
+    ViewAngleTable() = default;
+
+    /// Constructor: defines each view with its angle [rad].
+    ViewAngleTable(std::initializer_list<std::pair<View_t, double>> angles)
+      { for (auto const& [ view, angle ]: angles) setAngle(view, angle); }
+
+    /// Sets the angle of the specified `view` [rad].
+    /// @throw std::out_of_range if `view` is not a plane view
+    void setAngle(View_t view, double angle)
+      {
+        std::size_t const index = checkedIndex(view);
+        fAngles[index] = angle;
+        fDirections[index] = { std::cos(angle), std::sin(angle) };
+        fDefined[index] = true;
+      }
+
+    /// Returns whether the angle of `view` has been set.
+    bool hasView(View_t view) const
+      {
+        std::size_t const index = static_cast<std::size_t>(view);
+        return (index < NViews) && fDefined[index];
+      }
+
+    /// Returns the angle of the `view` [rad].
+    /// @throw std::out_of_range if the view is not defined
+    double angle(View_t view) const { return fAngles[definedIndex(view)]; }
+
+    /// Returns the cosine and sine of the angle of the `view`.
+    /// @throw std::out_of_range if the view is not defined
+    Direction_t const& direction(View_t view) const
+      { return fDirections[definedIndex(view)]; }
+
+    /// Returns the cosine of the angle of the `view`.
+    double cosAngle(View_t view) const { return direction(view).cos; }
+
+    /// Returns the sine of the angle of the `view`.
+    double sinAngle(View_t view) const { return direction(view).sin; }
+
+    /// Returns the projection of the point `(a, b)` on the `view` direction.
+    /// @throw std::out_of_range if the view is not defined
+    double project(View_t view, double a, double b) const
+      {
+        Direction_t const& dir = direction(view);
+        return dir.cos * a + dir.sin * b;
+      }
+
+    /**
+     * @brief Projects `n` points on the direction of `view`.
+     * @param view the view to project on
+     * @param n the number of points
+     * @param a pointer to the first coordinate of the points
+     * @param b pointer to the second coordinate of the points
+     * @param out pointer to the first of `n` results (may be `a` or `b`)
+     * @throw std::out_of_range if the view is not defined
+     */
+    template <typename T>
+    void project
+      (View_t view, std::size_t n, T const* a, T const* b, T* out) const;
+
+    /// Returns the projection of all the points on the direction of `view`.
+    /// @throw std::length_error if `a` and `b` have different size
+    /// @throw std::out_of_range if the view is not defined
+    template <typename T>
+    std::vector<T> project
+      (View_t view, std::vector<T> const& a, std::vector<T> const& b) const;
+
+  private:
+
+    std::array<double, NViews> fAngles {}; ///< Angle of each view.
+    std::array<Direction_t, NViews> fDirections {}; ///< Trigonometry cache.
+    std::array<bool, NViews> fDefined {}; ///< Whether each view is set.
+
+    /// Returns the index of `view`, throwing if out of the table.
+    static std::size_t checkedIndex(View_t view)
+      {
+        std::size_t const index = static_cast<std::size_t>(view);
+        if (index >= NViews) {
+          throw std::out_of_range
+            ("geo::ViewAngleTable: view #" + std::to_string(index)
+              + " is not a plane view");
+        }
+        return index;
+      }
+
+    /// Returns the index of `view`, throwing if the view is not defined.
+    std::size_t definedIndex(View_t view) const
+      {
+        std::size_t const index = checkedIndex(view);
+        if (!fDefined[index]) {
+          throw std::out_of_range
+            ("geo::ViewAngleTable: angle of view #" + std::to_string(index)
+              + " not defined");
+        }
+        return index;
+      }
+
+  }; // class ViewAngleTable
+
+} // namespace geo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T>
+void geo::ViewAngleTable::project
+  (View_t view, std::size_t n, T const* a, T const* b, T* out) const
+{
+  Direction_t const& dir = direction(view);
+  T const c = static_cast<T>(dir.cos);
+  T const s = static_cast<T>(dir.sin);
+  for (std::size_t i = 0; i < n; ++i) out[i] = c * a[i] + s * b[i];
+} // geo::ViewAngleTable::project()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+std::vector<T> geo::ViewAngleTable::project
+  (View_t view, std::vector<T> const& a, std::vector<T> const& b) const
+{
+  if (a.size() != b.size()) {
+    throw std::length_error(
+      "geo::ViewAngleTable::project(): coordinate vectors have different sizes"
+      );
+  }
+  std::vector<T> res(a.size());
+  project(view, a.size(), a.data(), b.data(), res.data());
+  return res;
+} // geo::ViewAngleTable::project(std::vector)
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VIEW_ANGLES_H
@@ -0,0 +1,212 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/readout_channel_ranges.h
+ * @brief  Sorted set of readout channel ranges, resolved from readout IDs.
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/readout_types_fhicl.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_CHANNEL_RANGES_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_CHANNEL_RANGES_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <vector>
+#include <algorithm> // std::sort(), std::upper_bound(), std::max()
+#include <iterator> // std::prev()
+#include <utility> // std::move()
+#include <stdexcept> // std::invalid_argument
+#include <string>
+#include <cstddef> // std::size_t
+
+
+namespace readout {
+
+  /// A range of contiguous channels, from `first` to `last` (both included).
+  struct ChannelRange {
+
+    raw::ChannelID_t first = raw::InvalidChannelID; ///< First channel.
+    raw::ChannelID_t last = raw::InvalidChannelID; ///< Last channel.
+
+    /// Returns whether the range has channels (`first` is a valid channel).
+    constexpr bool isValid() const { return raw::isValidChannelID(first); }
+
+    /// Returns the number of channels in the range.
+    constexpr std::size_t size() const
+      { return isValid()? std::size_t(last - first) + 1U: 0U; }
+
+    /// Returns whether `channel` is in the range.
+    constexpr bool contains(raw::ChannelID_t channel) const
+      { return isValid() && (channel >= first) && (channel <= last); }
+
+  }; // struct ChannelRange
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Sorted set of disjoint ranges of readout channels.
+   *
+   * The set is meant to be built once (typically at configuration time) from
+   * a list of readout elements, like readout planes (`readout::ROPID`) or TPC
+   * sets (`readout::TPCsetID`), and then queried many times on whether a
+   * channel belongs to any of them:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * readout::ChannelRangeSet const channels = readout::ChannelRangeSet::resolve
+   *   (ROPs, [&geom](readout::ROPID const& rop)
+   *     {
+   *       raw::ChannelID_t const first = geom.FirstChannelInROP(rop);
+   *       return
+   *         readout::ChannelRange{ first, first + geom.Nchannels(rop) - 1 };
+   *     }
+   *   );
+   *
+   * bool const selected = channels.contains(channel);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Overlapping or adjacent ranges are merged at construction, so that
+   * `contains()` is a binary search on the smallest possible number of ranges.
+   */
+  class ChannelRangeSet {
+
+  public:
+
+    /// Constructor: no channels.
+    ChannelRangeSet() = default;
+
+    /**
+     * @brief Constructor: sorts and merges the specified ranges.
+     * @param ranges the channel ranges
+     * @throw std::invalid_argument if a range has `last` before `first`
+     *
+     * Invalid ranges (i.e. with an invalid `first` channel) are ignored.
+     */
+    explicit ChannelRangeSet(std::vector<ChannelRange> ranges);
+
+    /**
+     * @brief Returns the set of channels of all the specified readout IDs.
+     * @tparam IDcoll type of collection of readout IDs
+     * @tparam Resolver type of callable object returning the channels of an ID
+     * @param IDs the readout IDs to be resolved
+     * @param resolver returns the channels of each ID
+     * @return the set of all the channels of `IDs`
+     * @throw std::invalid_argument if `resolver` returns a reversed range
+     *
+     * The `resolver` is called once for each valid ID in `IDs` (invalid IDs
+     * are skipped), and returns either a single `readout::ChannelRange` or a
+     * collection of them (e.g. `std::vector<readout::ChannelRange>`).
+     */
+    template <typename IDcoll, typename Resolver>
+    static ChannelRangeSet resolve(IDcoll const& IDs, Resolver&& resolver);
+
+    /// Returns whether there are no channels.
+    bool empty() const { return fRanges.empty(); }
+
+    /// Returns the number of (disjoint) ranges.
+    std::size_t nRanges() const { return fRanges.size(); }
+
+    /// Returns the total number of channels in all the ranges.
+    std::size_t nChannels() const;
+
+    /// Returns the sorted ranges.
+    std::vector<ChannelRange> const& ranges() const { return fRanges; }
+
+    /// Returns whether `channel` is in one of the ranges.
+    bool contains(raw::ChannelID_t channel) const;
+
+  private:
+
+    std::vector<ChannelRange> fRanges; ///< Sorted, disjoint ranges.
+
+    /// Appends `range` to `ranges`.
+    static void append
+      (std::vector<ChannelRange>& ranges, ChannelRange const& range)
+      { ranges.push_back(range); }
+
+    /// Appends all the ranges in `more` to `ranges`.
+    template <typename Ranges>
+    static void append(std::vector<ChannelRange>& ranges, Ranges const& more)
+      { for (ChannelRange const& range: more) ranges.push_back(range); }
+
+  }; // class ChannelRangeSet
+
+
+} // namespace readout
+
+
+// -----------------------------------------------------------------------------
+// ---  inline and template implementation
+// -----------------------------------------------------------------------------
+inline readout::ChannelRangeSet::ChannelRangeSet
+  (std::vector<ChannelRange> ranges)
+{
+  std::sort(ranges.begin(), ranges.end(),
+    [](ChannelRange const& a, ChannelRange const& b)
+      { return a.first < b.first; }
+    );
+
+  fRanges.reserve(ranges.size());
+  for (ChannelRange const& range: ranges) {
+    if (!range.isValid()) continue;
+    if (range.last < range.first) {
+      throw std::invalid_argument("readout::ChannelRangeSet: range from "
+        + std::to_string(range.first) + " to " + std::to_string(range.last)
+        + " is reversed");
+    }
+    if (!fRanges.empty()) {
+      ChannelRange& current = fRanges.back();
+      // written as `first - 1 <= last` it would overflow on channel 0
+      if (range.first <= current.last
+        || range.first - current.last == 1U
+      ) {
+        current.last = std::max(current.last, range.last);
+        continue;
+      }
+    }
+    fRanges.push_back(range);
+  } // for
+  fRanges.shrink_to_fit();
+
+} // readout::ChannelRangeSet::ChannelRangeSet()
+
+
+// -----------------------------------------------------------------------------
+template <typename IDcoll, typename Resolver>
+readout::ChannelRangeSet readout::ChannelRangeSet::resolve
+  (IDcoll const& IDs, Resolver&& resolver)
+{
+  std::vector<ChannelRange> ranges;
+  for (auto const& id: IDs) {
+    if (!id.isValid) continue;
+    append(ranges, resolver(id));
+  }
+  return ChannelRangeSet{ std::move(ranges) };
+} // readout::ChannelRangeSet::resolve()
+
+
+// -----------------------------------------------------------------------------
+inline std::size_t readout::ChannelRangeSet::nChannels() const {
+  std::size_t n = 0U;
+  for (ChannelRange const& range: fRanges) n += range.size();
+  return n;
+} // readout::ChannelRangeSet::nChannels()
+
+
+// -----------------------------------------------------------------------------
+inline bool readout::ChannelRangeSet::contains(raw::ChannelID_t channel) const
+{
+  // find the first range starting after `channel`; the previous one may have it
+  auto const it = std::upper_bound(fRanges.begin(), fRanges.end(), channel,
+    [](raw::ChannelID_t channel, ChannelRange const& range)
+      { return channel < range.first; }
+    );
+  return (it != fRanges.begin()) && (channel <= std::prev(it)->last);
+} // readout::ChannelRangeSet::contains()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_CHANNEL_RANGES_H
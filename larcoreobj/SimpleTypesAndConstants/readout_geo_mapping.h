@@ -0,0 +1,487 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/readout_geo_mapping.h
+ * @brief  Immutable mapping tables between readout and geometry IDs.
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/readout_id_indexing.h
+ *
+ * This library is header-only and depends only on standard C++ (and the ID
+ * definitions).
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_GEO_MAPPING_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_GEO_MAPPING_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_id_indexing.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <vector>
+#include <utility> // std::pair
+#include <stdexcept> // std::out_of_range, std::invalid_argument
+#include <string>
+#include <cstddef> // std::size_t
+
+
+namespace readout {
+
+  /// Layout of the wire planes: cryostats, TPCs per cryostat, planes per TPC.
+  using PlaneLayout = geo::IDlayout<3U>;
+
+  /// Layout of the wires: as `PlaneLayout`, plus wires per plane.
+  using WireLayout = geo::IDlayout<4U>;
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Non-owning view of a mapping between readout and wire planes.
+   * @see `readout::ROPplaneMapping`
+   *
+   * The mapping is made of two compressed sparse row tables, one with the
+   * wire planes of each readout plane, indexed by the dense index of the
+   * readout plane in a `readout::ROPlayout`, and one with the readout planes
+   * of each wire plane, indexed by the dense index of the wire plane in a
+   * `readout::PlaneLayout`.
+   *
+   * The view does not own the tables, which must stay available as long as
+   * the view (and any list obtained from it) is used. The tables may be held
+   * by a `readout::ROPplaneMapping` object, or be in some memory mapped from a
+   * file.
+   *
+   * All queries take constant time and do not allocate memory.
+   */
+  class ROPplaneMappingView {
+
+  public:
+
+    /// Type of list of wire planes.
+    using Planes_t = geo::PackedIDspan<geo::PlaneID>;
+
+    /// Type of list of readout planes.
+    using ROPs_t = geo::PackedIDspan<ROPID>;
+
+    /// Constructor: empty mapping.
+    ROPplaneMappingView() = default;
+
+    /**
+     * @brief Constructor: views the specified tables.
+     * @param ropLayout layout of all the readout planes
+     * @param planeLayout layout of all the wire planes
+     * @param planes table of the wire planes of each readout plane
+     * @param ROPs table of the readout planes of each wire plane
+     */
+    ROPplaneMappingView(
+      ROPlayout const& ropLayout, PlaneLayout const& planeLayout,
+      geo::PackedIDcsrView<geo::PlaneID> const& planes,
+      geo::PackedIDcsrView<ROPID> const& ROPs
+      )
+      : fROPlayout(ropLayout), fPlaneLayout(planeLayout)
+      , fPlanes(planes), fROPs(ROPs)
+      {}
+
+    /// Returns the layout of the readout planes.
+    ROPlayout const& ropLayout() const { return fROPlayout; }
+
+    /// Returns the layout of the wire planes.
+    PlaneLayout const& planeLayout() const { return fPlaneLayout; }
+
+    /// Returns the number of associations.
+    std::size_t nPairs() const { return fPlanes.nValues(); }
+
+    /// Returns the wire planes of `rop` (empty if `rop` is not in the layout).
+    Planes_t planes(ROPID const& rop) const
+      { return row(fPlanes, fROPlayout, rop); }
+
+    /// Returns the readout planes of `plane` (empty if not in the layout).
+    ROPs_t ROPs(geo::PlaneID const& plane) const
+      { return row(fROPs, fPlaneLayout, plane); }
+
+    /// Returns the first readout plane of `plane`, invalid if none.
+    ROPID ROP(geo::PlaneID const& plane) const
+      {
+        ROPs_t const rops = ROPs(plane);
+        return rops.empty()? ROPID{}: rops.front();
+      }
+
+    /// Returns the table of the wire planes of each readout plane.
+    geo::PackedIDcsrView<geo::PlaneID> const& planeTable() const
+      { return fPlanes; }
+
+    /// Returns the table of the readout planes of each wire plane.
+    geo::PackedIDcsrView<ROPID> const& ROPtable() const { return fROPs; }
+
+  private:
+
+    ROPlayout fROPlayout {{}}; ///< Layout of the readout planes.
+    PlaneLayout fPlaneLayout {{}}; ///< Layout of the wire planes.
+
+    geo::PackedIDcsrView<geo::PlaneID> fPlanes; ///< Planes by ROP index.
+    geo::PackedIDcsrView<ROPID> fROPs; ///< ROPs by plane index.
+
+    /// Returns the row of `id` in `table`, empty if not in `layout` or table.
+    template <typename Table, typename Layout, typename ID>
+    static typename Table::Span_t row
+      (Table const& table, Layout const& layout, ID const& id);
+
+  }; // class ROPplaneMappingView
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Bidirectional mapping between readout planes and wire planes.
+   *
+   * The mapping is built once from the list of all the associated
+   * (`readout::ROPID`, `geo::PlaneID`) pairs, typically extracted from the
+   * geometry service at the beginning of the job, and it is immutable
+   * afterwards. Each readout plane may be associated to many wire planes and
+   * vice versa. For example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<readout::ROPplaneMapping::Pair_t> pairs;
+   * for (readout::ROPID const& rop: geom.Iterate<readout::ROPID>())
+   *   for (geo::PlaneID const& plane: geom.ROPtoWirePlanes(rop))
+   *     pairs.emplace_back(rop, plane);
+   *
+   * readout::ROPplaneMapping const mapping
+   *   { ropLayout, planeLayout, pairs };
+   *
+   * for (geo::PlaneID const& plane: mapping.planes(rop)) { ... }
+   * readout::ROPID const rop = mapping.ROP(plane);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Both directions are stored as compressed sparse row tables indexed by the
+   * dense index of the ID in its layout, so that each query is a constant time
+   * look-up which does not allocate memory. The lists are sorted.
+   * The queries are the same as the ones of `readout::ROPplaneMappingView`,
+   * which can be obtained with `view()`.
+   */
+  class ROPplaneMapping {
+
+  public:
+
+    /// Type of an associated readout plane and wire plane pair.
+    using Pair_t = std::pair<ROPID, geo::PlaneID>;
+
+    /// Type of list of wire planes.
+    using Planes_t = ROPplaneMappingView::Planes_t;
+
+    /// Type of list of readout planes.
+    using ROPs_t = ROPplaneMappingView::ROPs_t;
+
+    /// Constructor: empty mapping.
+    ROPplaneMapping() = default;
+
+    /**
+     * @brief Constructor: builds the mapping from all the associated pairs.
+     * @param ropLayout layout of all the readout planes
+     * @param planeLayout layout of all the wire planes
+     * @param pairs all the associations
+     * @throw std::out_of_range if an ID in `pairs` is not in its layout
+     */
+    ROPplaneMapping(
+      ROPlayout const& ropLayout, PlaneLayout const& planeLayout,
+      std::vector<Pair_t> const& pairs
+      );
+
+    /// Returns a view of the mapping (valid as long as this object is).
+    ROPplaneMappingView view() const
+      { return { fROPlayout, fPlaneLayout, fPlanes.view(), fROPs.view() }; }
+
+    /// Returns the layout of the readout planes.
+    ROPlayout const& ropLayout() const { return fROPlayout; }
+
+    /// Returns the layout of the wire planes.
+    PlaneLayout const& planeLayout() const { return fPlaneLayout; }
+
+    /// Returns the number of associations.
+    std::size_t nPairs() const { return fPlanes.nValues(); }
+
+    /// Returns the wire planes of `rop` (empty if `rop` is not in the layout).
+    Planes_t planes(ROPID const& rop) const { return view().planes(rop); }
+
+    /// Returns the readout planes of `plane` (empty if not in the layout).
+    ROPs_t ROPs(geo::PlaneID const& plane) const
+      { return view().ROPs(plane); }
+
+    /// Returns the first readout plane of `plane`, invalid if none.
+    ROPID ROP(geo::PlaneID const& plane) const { return view().ROP(plane); }
+
+    /// Returns the table of the wire planes of each readout plane.
+    geo::PackedIDcsr<geo::PlaneID> const& planeTable() const
+      { return fPlanes; }
+
+    /// Returns the table of the readout planes of each wire plane.
+    geo::PackedIDcsr<ROPID> const& ROPtable() const { return fROPs; }
+
+  private:
+
+    ROPlayout fROPlayout {{}}; ///< Layout of the readout planes.
+    PlaneLayout fPlaneLayout {{}}; ///< Layout of the wire planes.
+
+    geo::PackedIDcsr<geo::PlaneID> fPlanes; ///< Planes by dense ROP index.
+    geo::PackedIDcsr<ROPID> fROPs; ///< ROPs by dense plane index.
+
+    /// Returns the dense index of `id` in `layout`, or throws.
+    template <typename Layout, typename ID>
+    static std::size_t checkedIndex(Layout const& layout, ID const& id);
+
+  }; // class ROPplaneMapping
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Non-owning view of a mapping between channels and wires.
+   * @see `readout::ChannelWireMapping`
+   *
+   * The mapping is made of two tables:
+   * * a compressed sparse row table with the wires of each channel, with one
+   *   row per channel number, from `0` to `nChannels() - 1`;
+   * * the channel of each wire, indexed by the dense index of the wire in a
+   *   `readout::WireLayout` (`raw::InvalidChannelID` for wires with no
+   *   channel).
+   *
+   * The view does not own the tables, which must stay available as long as
+   * the view (and any list of wires obtained from it) is used. The tables may
+   * be held by a `readout::ChannelWireMapping` object, or be in some memory
+   * mapped from a file.
+   *
+   * All queries take constant time and do not allocate memory.
+   */
+  class ChannelWireMappingView {
+
+  public:
+
+    /// Type of list of wires.
+    using Wires_t = geo::PackedIDspan<geo::WireID>;
+
+    /// Constructor: empty mapping.
+    ChannelWireMappingView() = default;
+
+    /**
+     * @brief Constructor: views the specified tables.
+     * @param wires table of the wires of each channel
+     * @param wireLayout layout of the wires
+     * @param channels channel of each wire (`wireLayout.size()` elements)
+     */
+    ChannelWireMappingView(
+      geo::PackedIDcsrView<geo::WireID> const& wires,
+      WireLayout const& wireLayout, raw::ChannelID_t const* channels
+      )
+      : fWires(wires), fWireLayout(wireLayout), fChannels(channels)
+      {}
+
+    /// Returns the number of channels (valid channels are smaller than this).
+    std::size_t nChannels() const { return fWires.nRows(); }
+
+    /// Returns whether `channel` is in the mapping.
+    bool hasChannel(raw::ChannelID_t channel) const
+      { return channel < nChannels(); }
+
+    /// Returns the layout of the wires.
+    WireLayout const& wireLayout() const { return fWireLayout; }
+
+    /// Returns the wires of `channel` (empty if not in the mapping).
+    Wires_t wires(raw::ChannelID_t channel) const
+      { return hasChannel(channel)? fWires[channel]: Wires_t{}; }
+
+    /// Returns the channel of `wire` (`raw::InvalidChannelID` if none).
+    raw::ChannelID_t channel(geo::WireID const& wire) const
+      {
+        return (fChannels && fWireLayout.contains(wire))
+          ? fChannels[fWireLayout.index(wire)]: raw::InvalidChannelID;
+      }
+
+    /// Returns the table of the wires of each channel.
+    geo::PackedIDcsrView<geo::WireID> const& wireTable() const
+      { return fWires; }
+
+    /// Returns the channel of each wire, by dense wire index.
+    raw::ChannelID_t const* channelTable() const { return fChannels; }
+
+  private:
+
+    geo::PackedIDcsrView<geo::WireID> fWires; ///< Wires by channel.
+    WireLayout fWireLayout {{}}; ///< Layout of the wires.
+    raw::ChannelID_t const* fChannels = nullptr; ///< Channels by wire index.
+
+  }; // class ChannelWireMappingView
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Mapping between channels and wires, owning its tables.
+   *
+   * The mapping is built once from the list of all the (channel, wire) pairs,
+   * typically extracted from the geometry service at the beginning of the job,
+   * and it is immutable afterwards:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<readout::ChannelWireMapping::Pair_t> pairs;
+   * for (geo::WireID const& wire: geom.Iterate<geo::WireID>())
+   *   pairs.emplace_back(geom.PlaneWireToChannel(wire), wire);
+   *
+   * readout::ChannelWireMapping const mapping
+   *   { geom.Nchannels(), wireLayout, pairs };
+   *
+   * for (geo::WireID const& wire: mapping.wires(channel)) { ... }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * A channel may have many wires, and each wire belongs to at most one
+   * channel. The wires of a channel are returned as a sorted list that refers
+   * to this object: unlike `std::vector<geo::WireID>`, getting it does not
+   * allocate memory. The queries are the same as the ones of
+   * `readout::ChannelWireMappingView`, which can be obtained with `view()`.
+   */
+  class ChannelWireMapping {
+
+  public:
+
+    /// Type of an associated channel and wire pair.
+    using Pair_t = std::pair<raw::ChannelID_t, geo::WireID>;
+
+    /// Type of list of wires.
+    using Wires_t = ChannelWireMappingView::Wires_t;
+
+    /// Constructor: empty mapping.
+    ChannelWireMapping() = default;
+
+    /**
+     * @brief Constructor: builds the mapping from all the associated pairs.
+     * @param nChannels number of channels (all smaller than this)
+     * @param wireLayout layout of all the wires
+     * @param pairs all the associations
+     * @throw std::out_of_range if a channel is not smaller than `nChannels` or
+     *                          a wire is not in `wireLayout`
+     * @throw std::invalid_argument if a wire is associated to two channels
+     */
+    ChannelWireMapping(
+      std::size_t nChannels, WireLayout const& wireLayout,
+      std::vector<Pair_t> const& pairs
+      );
+
+    /// Returns a view of the mapping (valid as long as this object is).
+    ChannelWireMappingView view() const
+      { return { fWires.view(), fWireLayout, fChannels.data() }; }
+
+    /// Returns the number of channels (valid channels are smaller than this).
+    std::size_t nChannels() const { return fWires.nRows(); }
+
+    /// Returns whether `channel` is in the mapping.
+    bool hasChannel(raw::ChannelID_t channel) const
+      { return channel < nChannels(); }
+
+    /// Returns the layout of the wires.
+    WireLayout const& wireLayout() const { return fWireLayout; }
+
+    /// Returns the wires of `channel` (empty if not in the mapping).
+    Wires_t wires(raw::ChannelID_t channel) const
+      { return view().wires(channel); }
+
+    /// Returns the channel of `wire` (`raw::InvalidChannelID` if none).
+    raw::ChannelID_t channel(geo::WireID const& wire) const
+      { return view().channel(wire); }
+
+    /// Returns the table of the wires of each channel.
+    geo::PackedIDcsr<geo::WireID> const& wireTable() const { return fWires; }
+
+    /// Returns the channel of each wire, by dense wire index.
+    std::vector<raw::ChannelID_t> const& channelTable() const
+      { return fChannels; }
+
+  private:
+
+    geo::PackedIDcsr<geo::WireID> fWires; ///< Wires by channel.
+    WireLayout fWireLayout {{}}; ///< Layout of the wires.
+    std::vector<raw::ChannelID_t> fChannels; ///< Channels by wire index.
+
+  }; // class ChannelWireMapping
+
+
+} // namespace readout
+
+
+// -----------------------------------------------------------------------------
+// ---  inline and template implementation
+// -----------------------------------------------------------------------------
+template <typename Table, typename Layout, typename ID>
+typename Table::Span_t readout::ROPplaneMappingView::row
+  (Table const& table, Layout const& layout, ID const& id)
+{
+  if (!layout.contains(id)) return {};
+  std::size_t const index = layout.index(id);
+  return (index < table.nRows())? table[index]: typename Table::Span_t{};
+} // readout::ROPplaneMappingView::row()
+
+
+// -----------------------------------------------------------------------------
+template <typename Layout, typename ID>
+std::size_t readout::ROPplaneMapping::checkedIndex
+  (Layout const& layout, ID const& id)
+{
+  if (!layout.contains(id)) {
+    throw std::out_of_range("readout::ROPplaneMapping: "
+      + (id.isValid? std::string(id): std::string("invalid ID"))
+      + " is not in the layout");
+  }
+  return layout.index(id);
+} // readout::ROPplaneMapping::checkedIndex()
+
+
+// -----------------------------------------------------------------------------
+inline readout::ROPplaneMapping::ROPplaneMapping(
+  ROPlayout const& ropLayout, PlaneLayout const& planeLayout,
+  std::vector<Pair_t> const& pairs
+)
+  : fROPlayout(ropLayout), fPlaneLayout(planeLayout)
+{
+  std::vector<geo::PackedIDcsr<geo::PlaneID>::Entry_t> planes;
+  std::vector<geo::PackedIDcsr<ROPID>::Entry_t> ROPs;
+  planes.reserve(pairs.size());
+  ROPs.reserve(pairs.size());
+  for (auto const& [ rop, plane ]: pairs) {
+    planes.emplace_back(checkedIndex(fROPlayout, rop), plane);
+    ROPs.emplace_back(checkedIndex(fPlaneLayout, plane), rop);
+  }
+  fPlanes = geo::PackedIDcsr<geo::PlaneID>{ fROPlayout.size(), planes };
+  fROPs = geo::PackedIDcsr<ROPID>{ fPlaneLayout.size(), ROPs };
+} // readout::ROPplaneMapping::ROPplaneMapping()
+
+
+// -----------------------------------------------------------------------------
+inline readout::ChannelWireMapping::ChannelWireMapping(
+  std::size_t nChannels, WireLayout const& wireLayout,
+  std::vector<Pair_t> const& pairs
+)
+  : fWireLayout(wireLayout)
+  , fChannels(fWireLayout.size(), raw::InvalidChannelID)
+{
+  std::vector<geo::PackedIDcsr<geo::WireID>::Entry_t> wires;
+  wires.reserve(pairs.size());
+  for (auto const& [ channel, wire ]: pairs) {
+    if (channel >= nChannels) {
+      throw std::out_of_range("readout::ChannelWireMapping: channel "
+        + std::to_string(channel) + " is not in the "
+        + std::to_string(nChannels) + " channels");
+    }
+    if (!fWireLayout.contains(wire)) {
+      throw std::out_of_range("readout::ChannelWireMapping: "
+        + (wire.isValid? std::string(wire): std::string("invalid ID"))
+        + " is not in the layout");
+    }
+    raw::ChannelID_t& wireChannel = fChannels[fWireLayout.index(wire)];
+    if (raw::isValidChannelID(wireChannel) && (wireChannel != channel)) {
+      throw std::invalid_argument("readout::ChannelWireMapping: "
+        + std::string(wire) + " is associated to both channel "
+        + std::to_string(wireChannel) + " and " + std::to_string(channel));
+    }
+    wireChannel = channel;
+    wires.emplace_back(channel, wire);
+  } // for
+  fWires = geo::PackedIDcsr<geo::WireID>{ nChannels, wires };
+} // readout::ChannelWireMapping::ChannelWireMapping()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_GEO_MAPPING_H
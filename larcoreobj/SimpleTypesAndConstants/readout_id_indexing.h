@@ -0,0 +1,55 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/readout_id_indexing.h
+ * @brief  Packed keys and dense containers for readout IDs.
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h
+ *
+ * This library is header-only and depends only on standard C++ (and the ID
+ * definitions).
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_ID_INDEXING_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_ID_INDEXING_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+
+namespace readout {
+
+  // --- BEGIN -- Importing from geo namespace ---------------------------------
+  /**
+   * @name Packed readout ID keys
+   *
+   * `readout::TPCsetID` and `readout::ROPID` are packed into a single 64-bit
+   * key with the same encoding as the geometry IDs, 16 bits per level, so that
+   * comparing and hashing them is a single integer operation. See
+   * `geo::packID()` for the details.
+   */
+  /// @{
+  using geo::PackedIDkey_t;
+  using geo::InvalidPackedIDkey;
+  using geo::packID;
+  using geo::unpackID;
+  /// @}
+  // --- END -- Importing from geo namespace -----------------------------------
+
+
+  /// Layout of the readout planes: cryostats, TPC sets per cryostat, readout
+  /// planes per TPC set.
+  using ROPlayout = geo::IDlayout<3U>;
+
+  /// Container with one element per TPC set.
+  template <typename T>
+  using TPCsetDataContainer = geo::IDcontainer<TPCsetID, T>;
+
+  /// Container with one element per readout plane.
+  template <typename T>
+  using ROPDataContainer = geo::IDcontainer<ROPID, T>;
+
+} // namespace readout
+
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_READOUT_ID_INDEXING_H
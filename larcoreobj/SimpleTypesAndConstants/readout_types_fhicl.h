@@ -13,11 +13,16 @@
 
 // LArSoft libraries
 #include "larcoreobj/SimpleTypesAndConstants/geo_types_fhicl.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_channel_ranges.h"
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
 // support libraries
 #include "fhiclcpp/types/Atom.h"
 
+// C/C++ standard libraries
+#include <optional>
+#include <utility> // std::forward()
+
 
 namespace geo::fhicl {
 
@@ -72,6 +77,8 @@ namespace readout::fhicl {
   using geo::fhicl::OptionalID;
   using geo::fhicl::IDsequence;
   using geo::fhicl::OptionalIDsequence;
+  using geo::fhicl::IndexedID;
+  using geo::fhicl::IndexedIDs;
 
   //
   // utilities
@@ -81,6 +88,16 @@ namespace readout::fhicl {
   using geo::fhicl::readIDsequence;
   using geo::fhicl::readOptionalIDsequence;
   using geo::fhicl::readParameter;
+  using geo::fhicl::readSortedIDsequence;
+  using geo::fhicl::readOptionalSortedIDsequence;
+  using geo::fhicl::readPackedIDsequence;
+  using geo::fhicl::readOptionalPackedIDsequence;
+  using geo::fhicl::readIDsequenceBits;
+  using geo::fhicl::readOptionalIDsequenceBits;
+  using geo::fhicl::readValidatedID;
+  using geo::fhicl::readOptionalValidatedID;
+  using geo::fhicl::readValidatedIDsequence;
+  using geo::fhicl::readOptionalValidatedIDsequence;
 
   // --- END -- Importing from geo::fhicl namespace ----------------------------
 
@@ -107,7 +124,9 @@ namespace readout::fhicl {
    * * a set of classes for readout plane parameters, characterized by a
    *   configuration like `{ C:0 S:1 R:2 }`;
    * * _no facility for `raw::ChannelID_t`_, which is a regular type and can be
-   *   directly read with the standard `fhicl` objects.
+   *   directly read with the standard `fhicl` objects; but sequences of
+   *   readout IDs can be resolved into sets of channels once for all with
+   *   `readout::fhicl::readChannelRanges()`.
    *
    */
   /// @{
@@ -170,9 +189,93 @@ namespace readout::fhicl {
   /// @}
   // --- END -- Validated configuration parameters for readout ID objects ------
 
+
+  // --- BEGIN -- Channel ranges -----------------------------------------------
+  /**
+   * @brief Returns the set of the channels of the IDs in the sequence.
+   * @tparam SrcID type of the ID read by the FHiCL parameter
+   * @tparam Resolver type of callable object returning the channels of an ID
+   * @param seq the sequence of ID parameters to convert
+   * @param resolver returns the channels of each ID
+   * @return the set of all the channels of the IDs in `seq`
+   * @throw std::invalid_argument if `resolver` returns a reversed range
+   * @see `readout::ChannelRangeSet::resolve()`
+   *
+   * The IDs are resolved into channels only once, after which the membership
+   * of a channel can be tested with `readout::ChannelRangeSet::contains()`
+   * without further calls to `resolver`. For example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * struct Config {
+   *
+   *   readout::fhicl::ROPIDsequence FilteredPlanes {
+   *     fhicl::Name("FilteredPlanes"),
+   *     fhicl::Comment("readout planes the filter is applied to")
+   *     };
+   *
+   * }; // struct Config
+   *
+   * readout::ChannelRangeSet const fFilteredChannels;
+   *
+   * MyAlgo(Config const& config, geo::GeometryCore const& geom)
+   *   : fFilteredChannels(readout::fhicl::readChannelRanges(
+   *       config.FilteredPlanes,
+   *       [&geom](readout::ROPID const& rop)
+   *         {
+   *           raw::ChannelID_t const first = geom.FirstChannelInROP(rop);
+   *           return readout::ChannelRange
+   *             { first, first + geom.Nchannels(rop) - 1 };
+   *         }
+   *     ))
+   *   {}
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Invalid IDs in the sequence are skipped.
+   */
+  template <typename SrcID, typename Resolver>
+  ChannelRangeSet readChannelRanges
+    (IDsequence<SrcID> const& seq, Resolver&& resolver);
+
+  /**
+   * @brief Returns the set of the channels of the IDs in the optional sequence.
+   * @tparam SrcID type of the ID read by the FHiCL parameter
+   * @tparam Resolver type of callable object returning the channels of an ID
+   * @param seq the optional sequence of ID parameters to convert
+   * @param resolver returns the channels of each ID
+   * @return the set of all the channels of `seq`, or no value if omitted
+   * @see `readChannelRanges()`
+   */
+  template <typename SrcID, typename Resolver>
+  std::optional<ChannelRangeSet> readOptionalChannelRanges
+    (OptionalIDsequence<SrcID> const& seq, Resolver&& resolver);
+
+  // --- END -- Channel ranges -------------------------------------------------
+
 } // namespace readout::fhicl
 
 
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Resolver>
+readout::ChannelRangeSet readout::fhicl::readChannelRanges
+  (IDsequence<SrcID> const& seq, Resolver&& resolver)
+{
+  return ChannelRangeSet::resolve
+    (readIDsequence(seq), std::forward<Resolver>(resolver));
+} // readout::fhicl::readChannelRanges()
+
+
+// -----------------------------------------------------------------------------
+template <typename SrcID, typename Resolver>
+std::optional<readout::ChannelRangeSet>
+readout::fhicl::readOptionalChannelRanges
+  (OptionalIDsequence<SrcID> const& seq, Resolver&& resolver)
+{
+  auto const IDs = readOptionalIDsequence(seq);
+  if (!IDs) return std::nullopt;
+  return ChannelRangeSet::resolve(*IDs, std::forward<Resolver>(resolver));
+} // readout::fhicl::readOptionalChannelRanges()
+
+
 // -----------------------------------------------------------------------------
 
 
@@ -0,0 +1,113 @@
+/**
+ * @file   larcoreobj/SummaryData/ConcurrentPOTAccumulator.cxx
+ * @brief  Accumulation of `sumdata::POTSummary` from concurrent threads.
+ * @see    larcoreobj/SummaryData/ConcurrentPOTAccumulator.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/ConcurrentPOTAccumulator.h"
+
+// C/C++ standard library
+#include <thread> // std::this_thread::yield()
+#include <stdexcept> // std::out_of_range
+#include <string>
+
+
+//------------------------------------------------------------------------------
+//--- sumdata::ConcurrentPOTAccumulator::Shard
+//------------------------------------------------------------------------------
+// Each shard is a sequence lock with a single writer: the writer makes the
+// sequence number odd, updates the state and makes it even again; readers
+// retry until they see the same even number before and after reading.
+// All the state is made of relaxed atomics, so that concurrent reading is
+// well defined; the fences order the state with respect to the sequence.
+//
+sumdata::POTAggregator sumdata::ConcurrentPOTAccumulator::Shard::load() const
+{
+  constexpr auto relaxed = std::memory_order_relaxed;
+  return {
+    { totPOT.load(relaxed), totPOTcompensation.load(relaxed) },
+    { goodPOT.load(relaxed), goodPOTcompensation.load(relaxed) },
+    totSpills.load(relaxed), goodSpills.load(relaxed)
+    };
+} // sumdata::ConcurrentPOTAccumulator::Shard::load()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTAggregator
+sumdata::ConcurrentPOTAccumulator::Shard::snapshot() const
+{
+  while (true) {
+    unsigned long int const before = sequence.load(std::memory_order_acquire);
+    if (before % 2U == 0U) {
+      POTAggregator const state = load();
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence.load(std::memory_order_relaxed) == before) return state;
+    }
+    std::this_thread::yield();
+  } // while
+} // sumdata::ConcurrentPOTAccumulator::Shard::snapshot()
+
+
+//------------------------------------------------------------------------------
+void sumdata::ConcurrentPOTAccumulator::Shard::store
+  (POTAggregator const& state)
+{
+  constexpr auto relaxed = std::memory_order_relaxed;
+  unsigned long int const seq = sequence.load(relaxed);
+  sequence.store(seq + 1U, relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  totPOT.store(state.totPOT().sum(), relaxed);
+  totPOTcompensation.store(state.totPOT().compensation(), relaxed);
+  goodPOT.store(state.goodPOT().sum(), relaxed);
+  goodPOTcompensation.store(state.goodPOT().compensation(), relaxed);
+  totSpills.store(state.totSpills(), relaxed);
+  goodSpills.store(state.goodSpills(), relaxed);
+
+  sequence.store(seq + 2U, std::memory_order_release);
+} // sumdata::ConcurrentPOTAccumulator::Shard::store()
+
+
+//------------------------------------------------------------------------------
+//--- sumdata::ConcurrentPOTAccumulator
+//------------------------------------------------------------------------------
+sumdata::ConcurrentPOTAccumulator::ConcurrentPOTAccumulator
+  (std::size_t nShards)
+  : fNShards(nShards)
+  , fShards(std::make_unique<Shard[]>(nShards))
+{}
+
+
+//------------------------------------------------------------------------------
+void sumdata::ConcurrentPOTAccumulator::add
+  (std::size_t shard, POTSummary const& summary)
+{
+  if (shard >= fNShards) {
+    throw std::out_of_range("sumdata::ConcurrentPOTAccumulator::add(): shard #"
+      + std::to_string(shard) + " requested, only "
+      + std::to_string(fNShards) + " available");
+  }
+  Shard& target = fShards[shard];
+  POTAggregator state = target.load();
+  state.add(summary);
+  target.store(state);
+} // sumdata::ConcurrentPOTAccumulator::add()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTAggregator sumdata::ConcurrentPOTAccumulator::aggregator() const {
+  POTAggregator total;
+  for (std::size_t i = 0; i < fNShards; ++i)
+    total.combine(fShards[i].snapshot());
+  return total;
+} // sumdata::ConcurrentPOTAccumulator::aggregator()
+
+
+//------------------------------------------------------------------------------
+void sumdata::ConcurrentPOTAccumulator::reset() {
+  for (std::size_t i = 0; i < fNShards; ++i) fShards[i].store({});
+} // sumdata::ConcurrentPOTAccumulator::reset()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,111 @@
+/**
+ * @file   larcoreobj/SummaryData/ConcurrentPOTAccumulator.h
+ * @brief  Accumulation of `sumdata::POTSummary` from concurrent threads.
+ * @see    larcoreobj/SummaryData/ConcurrentPOTAccumulator.cxx
+ *
+ * This library depends only on standard C++.
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_CONCURRENTPOTACCUMULATOR_H
+#define LARCOREOBJ_SUMMARYDATA_CONCURRENTPOTACCUMULATOR_H
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTAggregation.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard library
+#include <atomic>
+#include <memory> // std::unique_ptr
+#include <cstddef> // std::size_t
+
+
+namespace sumdata {
+
+  /**
+   * @brief Accumulates `POTSummary` objects from many threads without locks.
+   *
+   * The accumulator has a fixed number of shards, each one accumulated by a
+   * single thread at a time: in an art job, the natural choice is one shard per
+   * schedule, with the schedule index as shard index. Adding to a shard does
+   * not wait for other threads, and the shards live on different cache lines,
+   * so that threads don't slow each other down.
+   *
+   * Within each shard, exposures are summed with compensation and spills are
+   * counted with 64-bit integers, like in `sumdata::POTAggregator`.
+   *
+   * `summary()` may be called at any time from any thread: it combines the
+   * shards in shard order, reading a consistent state of each one (a shard
+   * being updated is read again). Spreading the same input over a different
+   * number of shards changes the exposure only within the rounding of the
+   * compensated sums.
+   *
+   * Requirements:
+   * * each shard is written by at most one thread at a time;
+   * * `reset()` is called while no thread is adding.
+   */
+  class ConcurrentPOTAccumulator {
+
+  public:
+
+    /// Size assumed for a cache line, used to keep shards apart.
+    static constexpr std::size_t CacheLineSize = 64U;
+
+    /// Constructor: accumulator with `nShards` shards.
+    explicit ConcurrentPOTAccumulator(std::size_t nShards);
+
+    /// Returns the number of shards.
+    std::size_t nShards() const { return fNShards; }
+
+    /**
+     * @brief Adds `summary` to the specified shard.
+     * @param shard index of the shard to add into
+     * @param summary the summary to be added
+     * @throw std::out_of_range if `shard` is not smaller than `nShards()`
+     *
+     * Only one thread at a time may add to each shard.
+     */
+    void add(std::size_t shard, POTSummary const& summary);
+
+    /// Returns the current state of the accumulation of all shards.
+    POTAggregator aggregator() const;
+
+    /// Returns the summary of the current state of the accumulation.
+    /// @throw std::overflow_error if spill counts don't fit `POTSummary`
+    POTSummary summary() const { return aggregator().summary(); }
+
+    /// Clears all shards (no thread may be adding at the same time).
+    void reset();
+
+  private:
+
+    /// State of a shard, protected by a sequence counter.
+    struct alignas(CacheLineSize) Shard {
+      /// Odd while the shard is being written.
+      std::atomic<unsigned long int> sequence { 0U };
+      std::atomic<double> totPOT { 0.0 };
+      std::atomic<double> totPOTcompensation { 0.0 };
+      std::atomic<double> goodPOT { 0.0 };
+      std::atomic<double> goodPOTcompensation { 0.0 };
+      std::atomic<long long int> totSpills { 0 };
+      std::atomic<long long int> goodSpills { 0 };
+
+      /// Returns the state (to be called by the only writer of the shard).
+      POTAggregator load() const;
+
+      /// Returns a consistent state even while the shard is being written.
+      POTAggregator snapshot() const;
+
+      /// Sets the state (to be called by the only writer of the shard).
+      void store(POTAggregator const& state);
+
+    }; // struct Shard
+
+    std::size_t fNShards; ///< Number of shards.
+    std::unique_ptr<Shard[]> fShards; ///< Storage of the shards.
+
+  }; // class ConcurrentPOTAccumulator
+
+} // namespace sumdata
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_CONCURRENTPOTACCUMULATOR_H
@@ -0,0 +1,116 @@
+/**
+ * @file   larcoreobj/SummaryData/GeometryConfigurationCompatibility.cxx
+ * @brief  Compatibility check between geometry configurations.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationCompatibility.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationCompatibility.h"
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard library
+#include <mutex> // std::unique_lock
+#include <utility> // std::move()
+
+
+namespace {
+
+  /// Version from which the service configuration is included.
+  constexpr sumdata::GeometryConfigurationInfo::DataVersion_t
+    ConfigurationVersion = 2U;
+
+  /// Returns whether the information includes the service configuration.
+  bool hasConfiguration(sumdata::GeometryConfigurationInfo const& info)
+    { return info.dataVersion >= ConfigurationVersion; }
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+sumdata::ContentDigest sumdata::canonicalConfigurationDigest
+  (GeometryConfigurationInfo const& info)
+{
+  return ContentDigest::of(info.serviceParameters().to_string());
+} // sumdata::canonicalConfigurationDigest()
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::compatibleGeometryConfigurations
+  (GeometryConfigurationInfo const& a, GeometryConfigurationInfo const& b)
+{
+  if (!a.isDataValid() || !b.isDataValid()) return false;
+  if (a.detectorName != b.detectorName) return false;
+  if (!hasConfiguration(a) || !hasConfiguration(b)) return true;
+  if (a.serviceConfiguration() == b.serviceConfiguration()) return true;
+  return canonicalConfigurationDigest(a) == canonicalConfigurationDigest(b);
+} // sumdata::compatibleGeometryConfigurations()
+
+
+// -----------------------------------------------------------------------------
+// ---  sumdata::GeometryCompatibilityChecker
+// -----------------------------------------------------------------------------
+sumdata::GeometryCompatibilityChecker::GeometryCompatibilityChecker
+  (GeometryConfigurationInfo reference)
+  : fReference(std::move(reference))
+  , fReferenceCanonical(
+      hasConfiguration(fReference)
+        ? canonicalConfigurationDigest(fReference): ContentDigest{}
+    )
+{}
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::GeometryCompatibilityChecker::isCompatible
+  (GeometryConfigurationInfo const& info) const
+  { return isCompatible(info, info.contentDigest()); }
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::GeometryCompatibilityChecker::isCompatible
+  (DigestedGeometryConfiguration const& config) const
+{
+  return config.hasInfo()
+    && isCompatible(config.info(), config.digest());
+} // sumdata::GeometryCompatibilityChecker::isCompatible(Digested...)
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::GeometryCompatibilityChecker::isCompatible
+  (GeometryConfigurationInfo const& info, ContentDigest const& digest) const
+{
+  {
+    std::shared_lock<std::shared_mutex> const readLock { fLock };
+    auto const it = fKnown.find(digest);
+    if (it != fKnown.end()) return it->second;
+  }
+
+  bool const compatible = check(info); // parsing happens outside of the lock
+
+  std::unique_lock<std::shared_mutex> const writeLock { fLock };
+  fKnown.emplace(digest, compatible);
+  return compatible;
+} // sumdata::GeometryCompatibilityChecker::isCompatible()
+
+
+// -----------------------------------------------------------------------------
+std::size_t sumdata::GeometryCompatibilityChecker::nKnownConfigurations() const
+{
+  std::shared_lock<std::shared_mutex> const readLock { fLock };
+  return fKnown.size();
+} // sumdata::GeometryCompatibilityChecker::nKnownConfigurations()
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::GeometryCompatibilityChecker::check
+  (GeometryConfigurationInfo const& info) const
+{
+  if (!fReference.isDataValid() || !info.isDataValid()) return false;
+  if (fReference.detectorName != info.detectorName) return false;
+  if (!hasConfiguration(fReference) || !hasConfiguration(info)) return true;
+  return canonicalConfigurationDigest(info) == fReferenceCanonical;
+} // sumdata::GeometryCompatibilityChecker::check()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,127 @@
+/**
+ * @file   larcoreobj/SummaryData/GeometryConfigurationCompatibility.h
+ * @brief  Compatibility check between geometry configurations.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationCompatibility.cxx
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONCOMPATIBILITY_H
+#define LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONCOMPATIBILITY_H
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationDigest.h"
+#include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+
+// C/C++ standard library
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace sumdata {
+
+  /**
+   * @brief Returns the digest of the canonical form of the configuration.
+   * @throw fhicl::exception if the configuration is not valid FHiCL
+   *
+   * The configuration is parsed (see
+   * `GeometryConfigurationInfo::serviceParameters()`) and the digest is
+   * computed on its canonical FHiCL representation, which does not depend on
+   * white space, comments or the order of the parameters in the tables.
+   */
+  ContentDigest canonicalConfigurationDigest
+    (GeometryConfigurationInfo const& info);
+
+
+  /**
+   * @brief Returns whether two geometry configurations are compatible.
+   *
+   * Two configurations are compatible if both are valid, they have the same
+   * detector name and, if both include it (data version `2` or later), the
+   * same service configuration up to white space, comments and parameter
+   * order. The data version itself is not required to match: the most
+   * complete test supported by both is performed.
+   *
+   * This function parses the configurations every time: to check many
+   * configurations against the same one, `GeometryCompatibilityChecker` is
+   * faster.
+   */
+  bool compatibleGeometryConfigurations
+    (GeometryConfigurationInfo const& a, GeometryConfigurationInfo const& b);
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Checks geometry configurations against a reference one.
+   *
+   * The criteria of `compatibleGeometryConfigurations()` are applied.
+   * The canonical digest of the reference configuration is computed once at
+   * construction. The result of each check is remembered by the exact digest
+   * of the checked configuration (`GeometryConfigurationInfo::contentDigest()`,
+   * computed once per configuration object), so that checking again a
+   * configuration with the same content, as is typical when opening many
+   * files from the same production, costs one hash table lookup and no
+   * parsing. Checking again the same configuration object (or a
+   * `DigestedGeometryConfiguration`) does not even digest its content.
+   *
+   * The checker may be used concurrently from multiple threads.
+   */
+  class GeometryCompatibilityChecker {
+
+  public:
+
+    /// Constructor: checks against the `reference` configuration.
+    explicit GeometryCompatibilityChecker(GeometryConfigurationInfo reference);
+
+    /// Returns the reference configuration.
+    GeometryConfigurationInfo const& reference() const { return fReference; }
+
+    /**
+     * @brief Returns whether `info` is compatible with the reference one.
+     * @see `GeometryConfigurationInfo::contentDigest()`
+     *
+     * The result is remembered by the digest of `info`, which `info` caches;
+     * a modified copy of `info` is digested anew.
+     */
+    bool isCompatible(GeometryConfigurationInfo const& info) const;
+
+    /// Returns whether `config` is compatible with the reference one.
+    bool isCompatible(DigestedGeometryConfiguration const& config) const;
+
+    /// Returns the number of distinct configurations checked so far.
+    std::size_t nKnownConfigurations() const;
+
+  private:
+
+    /// Hash of the digest (its lower bits are already well mixed).
+    struct DigestHash {
+      std::size_t operator() (ContentDigest const& digest) const
+        { return static_cast<std::size_t>(digest.low); }
+    };
+
+    GeometryConfigurationInfo fReference; ///< The reference configuration.
+
+    /// Canonical digest of the reference configuration (if version >= 2).
+    ContentDigest fReferenceCanonical;
+
+    /// Results of the checks so far, by exact digest of the configuration.
+    mutable std::unordered_map<ContentDigest, bool, DigestHash> fKnown;
+
+    mutable std::shared_mutex fLock; ///< Lock for `fKnown`.
+
+    /// Returns whether `info` (with `digest`) is compatible with the reference.
+    bool isCompatible
+      (GeometryConfigurationInfo const& info, ContentDigest const& digest)
+      const;
+
+    /// Performs the full check of `info` against the reference.
+    bool check(GeometryConfigurationInfo const& info) const;
+
+  }; // class GeometryCompatibilityChecker
+
+} // namespace sumdata
+
+
+// -----------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONCOMPATIBILITY_H
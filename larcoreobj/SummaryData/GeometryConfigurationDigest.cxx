@@ -0,0 +1,225 @@
+/**
+ * @file   larcoreobj/SummaryData/GeometryConfigurationDigest.cxx
+ * @brief  Content digest and deduplication of geometry configurations.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationDigest.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationDigest.h"
+
+// C/C++ standard library
+#include <ostream>
+#include <mutex> // std::unique_lock
+#include <utility> // std::move()
+
+
+namespace {
+
+  // --- BEGIN -- MurmurHash3, x64 128-bit variant -----------------------------
+  constexpr std::uint64_t rotl64(std::uint64_t x, int r)
+    { return (x << r) | (x >> (64 - r)); }
+
+  constexpr std::uint64_t fmix64(std::uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+  } // fmix64()
+
+  /// Reads 8 bytes as a little endian number.
+  std::uint64_t readBlock(unsigned char const* data) {
+    std::uint64_t value = 0U;
+    for (int i = 7; i >= 0; --i) value = (value << 8) | data[i];
+    return value;
+  } // readBlock()
+
+  constexpr std::uint64_t c1 = 0x87c37b91114253d5ULL;
+  constexpr std::uint64_t c2 = 0x4cf5ad432745937fULL;
+
+  std::uint64_t mixK1(std::uint64_t k1)
+    { k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; return k1; }
+  std::uint64_t mixK2(std::uint64_t k2)
+    { k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; return k2; }
+
+  sumdata::ContentDigest murmurHash3_x64_128
+    (std::string_view input, std::uint64_t seed)
+  {
+    auto const* data = reinterpret_cast<unsigned char const*>(input.data());
+    std::size_t const length = input.size();
+    std::size_t const nBlocks = length / 16U;
+
+    std::uint64_t h1 = seed;
+    std::uint64_t h2 = seed;
+
+    for (std::size_t i = 0; i < nBlocks; ++i) {
+      unsigned char const* block = data + i * 16U;
+      h1 ^= mixK1(readBlock(block));
+      h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+      h2 ^= mixK2(readBlock(block + 8));
+      h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+    } // for
+
+    unsigned char const* tail = data + nBlocks * 16U;
+    std::size_t const tailLength = length % 16U;
+    std::uint64_t k1 = 0U;
+    std::uint64_t k2 = 0U;
+    for (std::size_t i = 0; i < tailLength; ++i) {
+      std::uint64_t const byte = tail[i];
+      if (i < 8U) k1 |= byte << (8U * i);
+      else        k2 |= byte << (8U * (i - 8U));
+    }
+    if (tailLength > 8U) h2 ^= mixK2(k2);
+    if (tailLength > 0U) h1 ^= mixK1(k1);
+
+    h1 ^= length;
+    h2 ^= length;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+
+    return { h1, h2 };
+  } // murmurHash3_x64_128()
+  // --- END -- MurmurHash3, x64 128-bit variant -------------------------------
+
+
+  /// Appends `value` to `buffer` as 8 little endian bytes.
+  void appendNumber(std::string& buffer, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      buffer.push_back(static_cast<char>(value & 0xFFU));
+      value >>= 8;
+    }
+  } // appendNumber()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+// ---  sumdata::ContentDigest
+// -----------------------------------------------------------------------------
+std::string sumdata::ContentDigest::toString() const {
+  static constexpr char Digits[] = "0123456789abcdef";
+  std::string s(32U, '0');
+  for (int i = 0; i < 16; ++i) {
+    s[15 - i] = Digits[(high >> (4 * i)) & 0xFU];
+    s[31 - i] = Digits[(low >> (4 * i)) & 0xFU];
+  }
+  return s;
+} // sumdata::ContentDigest::toString()
+
+
+// -----------------------------------------------------------------------------
+sumdata::ContentDigest sumdata::ContentDigest::of
+  (std::string_view data, std::uint64_t seed /* = 0 */)
+  { return murmurHash3_x64_128(data, seed); }
+
+
+// -----------------------------------------------------------------------------
+std::ostream& sumdata::operator<<
+  (std::ostream& out, ContentDigest const& digest)
+  { return out << digest.toString(); }
+
+
+// -----------------------------------------------------------------------------
+sumdata::ContentDigest sumdata::geometryConfigurationDigest
+  (GeometryConfigurationInfo const& info)
+{
+  std::string const& config = info.serviceConfiguration();
+  std::string buffer;
+  buffer.reserve(24U + info.detectorName.size() + config.size());
+  appendNumber(buffer, info.dataVersion);
+  appendNumber(buffer, info.detectorName.size());
+  buffer += info.detectorName;
+  appendNumber(buffer, config.size());
+  buffer += config;
+  return ContentDigest::of(buffer);
+} // sumdata::geometryConfigurationDigest()
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::sameContent
+  (GeometryConfigurationInfo const& a, GeometryConfigurationInfo const& b)
+{
+  return (a.dataVersion == b.dataVersion)
+    && (a.detectorName == b.detectorName)
+    && (a.serviceConfiguration() == b.serviceConfiguration())
+    ;
+} // sumdata::sameContent()
+
+
+// -----------------------------------------------------------------------------
+// ---  sumdata::DigestedGeometryConfiguration
+// -----------------------------------------------------------------------------
+sumdata::DigestedGeometryConfiguration::DigestedGeometryConfiguration
+  (GeometryConfigurationInfo info)
+  : DigestedGeometryConfiguration
+    { std::make_shared<GeometryConfigurationInfo const>(std::move(info)) }
+{}
+
+
+// -----------------------------------------------------------------------------
+sumdata::DigestedGeometryConfiguration::DigestedGeometryConfiguration
+  (std::shared_ptr<GeometryConfigurationInfo const> info)
+  : fInfo(std::move(info))
+  , fDigest(fInfo? fInfo->contentDigest(): ContentDigest{})
+{}
+
+
+// -----------------------------------------------------------------------------
+bool sumdata::DigestedGeometryConfiguration::operator==
+  (DigestedGeometryConfiguration const& other) const
+{
+  if (fDigest != other.fDigest) return false;
+  if (fInfo == other.fInfo) return true;
+  if (!fInfo || !other.fInfo) return false;
+  return sameContent(*fInfo, *other.fInfo); // protection against collisions
+} // sumdata::DigestedGeometryConfiguration::operator==()
+
+
+// -----------------------------------------------------------------------------
+// ---  sumdata::GeometryConfigurationStore
+// -----------------------------------------------------------------------------
+sumdata::DigestedGeometryConfiguration sumdata::GeometryConfigurationStore::add
+  (GeometryConfigurationInfo const& info)
+{
+  DigestedGeometryConfiguration config { info }; // digest outside of the lock
+
+  {
+    std::shared_lock<std::shared_mutex> const readLock { fLock };
+    if (auto const stored = find(config)) return *stored;
+  }
+
+  std::unique_lock<std::shared_mutex> const writeLock { fLock };
+  if (auto const stored = find(config)) return *stored; // added meanwhile
+  fConfigs[config.digest()].push_back(config);
+  return config;
+} // sumdata::GeometryConfigurationStore::add()
+
+
+// -----------------------------------------------------------------------------
+std::size_t sumdata::GeometryConfigurationStore::size() const {
+  std::shared_lock<std::shared_mutex> const readLock { fLock };
+  std::size_t n = 0U;
+  for (auto const& entry: fConfigs) n += entry.second.size();
+  return n;
+} // sumdata::GeometryConfigurationStore::size()
+
+
+// -----------------------------------------------------------------------------
+sumdata::DigestedGeometryConfiguration const*
+sumdata::GeometryConfigurationStore::find
+  (DigestedGeometryConfiguration const& config) const
+{
+  auto const it = fConfigs.find(config.digest());
+  if (it == fConfigs.end()) return nullptr;
+  for (DigestedGeometryConfiguration const& stored: it->second)
+    if (stored == config) return &stored;
+  return nullptr;
+} // sumdata::GeometryConfigurationStore::find()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,188 @@
+/**
+ * @file   larcoreobj/SummaryData/GeometryConfigurationDigest.h
+ * @brief  Content digest and deduplication of geometry configurations.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationDigest.cxx
+ *
+ * This library depends only on standard C++.
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONDIGEST_H
+#define LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONDIGEST_H
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+
+// C/C++ standard library
+#include <unordered_map>
+#include <vector>
+#include <memory> // std::shared_ptr
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <iosfwd>
+#include <cstdint> // std::uint64_t
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace sumdata {
+
+  /**
+   * @brief A 128-bit digest of some content.
+   *
+   * The digest is computed with the 128-bit, 64-bit platform variant of the
+   * MurmurHash3 algorithm (public domain, by Austin Appleby), with the input
+   * bytes read in little endian order on all platforms: the same content has
+   * the same digest on any platform and in any process, and the digest may be
+   * stored.
+   *
+   * This is not a cryptographic hash: it is good at telling different
+   * contents apart, but not against deliberate collisions.
+   */
+  struct ContentDigest {
+
+    std::uint64_t low = 0U; ///< Lower 64 bits.
+    std::uint64_t high = 0U; ///< Higher 64 bits.
+
+    bool operator== (ContentDigest const& other) const
+      { return (low == other.low) && (high == other.high); }
+    bool operator!= (ContentDigest const& other) const
+      { return !(*this == other); }
+    bool operator< (ContentDigest const& other) const
+      { return (high != other.high)? high < other.high: low < other.low; }
+
+    /// Returns the digest as 32 hexadecimal digits.
+    std::string toString() const;
+
+    /// Returns the digest of the bytes in `data`.
+    static ContentDigest of(std::string_view data, std::uint64_t seed = 0U);
+
+  }; // struct ContentDigest
+
+  std::ostream& operator<< (std::ostream& out, ContentDigest const& digest);
+
+
+  /**
+   * @brief Returns the digest of the content of a geometry configuration.
+   *
+   * The digest covers data version, detector name and full configuration,
+   * each with its size, so that different splits of the same text between
+   * name and configuration have different digests. The configuration is
+   * digested in its decompressed form.
+   *
+   * The digest is computed anew on each call:
+   * `GeometryConfigurationInfo::contentDigest()` returns the same value,
+   * computed only once per object.
+   */
+  ContentDigest geometryConfigurationDigest
+    (GeometryConfigurationInfo const& info);
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Shared, immutable geometry configuration with its digest.
+   *
+   * The digest is computed once at construction. The comparison first compares
+   * the digests, and only if they match it checks whether the content is the
+   * same object or, failing that, compares the whole content.
+   * Copies share the same configuration object.
+   */
+  class DigestedGeometryConfiguration {
+
+  public:
+
+    /// Constructor: no configuration.
+    DigestedGeometryConfiguration() = default;
+
+    /// Constructor: takes and digests the configuration `info`.
+    explicit DigestedGeometryConfiguration(GeometryConfigurationInfo info);
+
+    /// Constructor: shares and digests the configuration `info`.
+    explicit DigestedGeometryConfiguration
+      (std::shared_ptr<GeometryConfigurationInfo const> info);
+
+    /// Returns whether this object holds a configuration.
+    bool hasInfo() const { return bool(fInfo); }
+
+    /// Returns the configuration (undefined behaviour if `!hasInfo()`).
+    GeometryConfigurationInfo const& info() const { return *fInfo; }
+
+    /// Returns the shared pointer to the configuration.
+    std::shared_ptr<GeometryConfigurationInfo const> const& sharedInfo() const
+      { return fInfo; }
+
+    /// Returns the digest of the configuration.
+    ContentDigest const& digest() const { return fDigest; }
+
+    /// Returns whether the two configurations have the same content.
+    bool operator== (DigestedGeometryConfiguration const& other) const;
+
+    /// Returns whether the two configurations have different content.
+    bool operator!= (DigestedGeometryConfiguration const& other) const
+      { return !(*this == other); }
+
+  private:
+
+    /// The configuration.
+    std::shared_ptr<GeometryConfigurationInfo const> fInfo;
+
+    ContentDigest fDigest; ///< Digest of the configuration content.
+
+  }; // class DigestedGeometryConfiguration
+
+
+  /// Returns whether the two configurations have exactly the same content.
+  bool sameContent
+    (GeometryConfigurationInfo const& a, GeometryConfigurationInfo const& b);
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Keeps a single copy of each distinct geometry configuration.
+   *
+   * Configurations added to the store are returned as
+   * `DigestedGeometryConfiguration`; adding a configuration with the same
+   * content of one already in the store returns the existing copy, so that
+   * equal configurations share memory and compare by pointer.
+   *
+   * The store may be used concurrently from multiple threads. Stored
+   * configurations are never removed: they live at least as long as the store
+   * and any of the returned objects.
+   */
+  class GeometryConfigurationStore {
+
+  public:
+
+    /// Returns the stored copy of a configuration with the content of `info`.
+    DigestedGeometryConfiguration add(GeometryConfigurationInfo const& info);
+
+    /// Returns the number of distinct configurations in the store.
+    std::size_t size() const;
+
+  private:
+
+    /// Hash of the digest (its lower bits are already well mixed).
+    struct DigestHash {
+      std::size_t operator() (ContentDigest const& digest) const
+        { return static_cast<std::size_t>(digest.low); }
+    };
+
+    /// All configurations by digest (more than one only in case of collision).
+    std::unordered_map<
+      ContentDigest, std::vector<DigestedGeometryConfiguration>, DigestHash
+      > fConfigs;
+
+    mutable std::shared_mutex fLock; ///< Lock for `fConfigs`.
+
+    /// Returns the stored configuration equal to `config`, if any.
+    DigestedGeometryConfiguration const* find
+      (DigestedGeometryConfiguration const& config) const;
+
+  }; // class GeometryConfigurationStore
+
+} // namespace sumdata
+
+
+// -----------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONDIGEST_H
@@ -9,9 +9,215 @@
  */
 
 #include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+#include "larcoreobj/SummaryData/GeometryConfigurationDigest.h"
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+
+// ZLib library
+#include <zlib.h>
 
 // C/C++ standard library
 #include <ostream>
+#include <mutex> // std::once_flag, std::call_once()
+#include <stdexcept> // std::runtime_error
+#include <utility> // std::move()
+#include <limits> // std::numeric_limits
+#include <cstdint> // std::uint64_t
+
+
+// -----------------------------------------------------------------------------
+struct sumdata::details::GeometryConfigurationCache {
+  
+  std::once_flag decoded; ///< Flag for the decompression of the configuration.
+  std::string configuration; ///< The decompressed configuration.
+  
+  std::once_flag parsed; ///< Flag for the parsing of the configuration.
+  fhicl::ParameterSet parameters; ///< The parsed configuration.
+  
+  std::once_flag digested; ///< Flag for the digest of the content.
+  ContentDigest digest; ///< The digest of the content.
+  
+}; // sumdata::details::GeometryConfigurationCache
+
+
+// -----------------------------------------------------------------------------
+namespace {
+  
+  /// Size of the header of compressed data (the uncompressed size).
+  constexpr std::size_t CompressedHeaderSize = 8U;
+  
+  /// Largest expansion of deflate data (zlib technical details: 1032:1).
+  constexpr std::uint64_t MaxCompressionRatio = 1032U;
+  
+  /// Compresses `data`, prepending its size as 8 little endian bytes.
+  std::vector<unsigned char> compressConfiguration(std::string const& data) {
+    
+    uLongf compressedSize = compressBound(data.size());
+    std::vector<unsigned char> buffer(CompressedHeaderSize + compressedSize);
+    
+    std::uint64_t size = data.size();
+    for (std::size_t i = 0; i < CompressedHeaderSize; ++i, size >>= 8U)
+      buffer[i] = static_cast<unsigned char>(size & 0xFFU);
+    
+    int const res = compress2(buffer.data() + CompressedHeaderSize,
+      &compressedSize, reinterpret_cast<Bytef const*>(data.data()),
+      data.size(), Z_BEST_COMPRESSION);
+    if (res != Z_OK) {
+      throw std::runtime_error("sumdata::GeometryConfigurationInfo: "
+        "failed to compress the configuration (zlib error "
+        + std::to_string(res) + ")");
+    }
+    buffer.resize(CompressedHeaderSize + compressedSize);
+    return buffer;
+  } // compressConfiguration()
+  
+  
+  /// Decompresses data from `compressConfiguration()`.
+  std::string decompressConfiguration(std::vector<unsigned char> const& data)
+  {
+    if (data.size() < CompressedHeaderSize) {
+      throw std::runtime_error("sumdata::GeometryConfigurationInfo: "
+        "compressed configuration is truncated");
+    }
+    std::uint64_t size = 0U;
+    for (std::size_t i = CompressedHeaderSize; i > 0; --i)
+      size = (size << 8U) | data[i - 1];
+    
+    // the declared size is checked before allocating anything for it:
+    // deflate can't expand the data more than `MaxCompressionRatio` times
+    std::uint64_t const streamSize = data.size() - CompressedHeaderSize;
+    if ((size > streamSize * MaxCompressionRatio)
+      || (size > std::numeric_limits<uLongf>::max())
+      || (size >= std::string{}.max_size())
+    ) {
+      throw std::runtime_error("sumdata::GeometryConfigurationInfo: "
+        "compressed configuration is corrupted (declares "
+        + std::to_string(size) + " bytes from " + std::to_string(streamSize)
+        + " compressed ones)");
+    }
+    
+    std::string decoded(size, '\0');
+    uLongf decodedSize = size;
+    int const res = uncompress(
+      reinterpret_cast<Bytef*>(decoded.data()), &decodedSize,
+      data.data() + CompressedHeaderSize, streamSize
+      );
+    if (res != Z_OK) {
+      throw std::runtime_error("sumdata::GeometryConfigurationInfo: "
+        "compressed configuration is corrupted (zlib error "
+        + std::to_string(res) + ")");
+    }
+    if (decodedSize != size) {
+      throw std::runtime_error("sumdata::GeometryConfigurationInfo: "
+        "compressed configuration is corrupted (declares "
+        + std::to_string(size) + " bytes, " + std::to_string(decodedSize)
+        + " decompressed)");
+    }
+    return decoded;
+  } // decompressConfiguration()
+  
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+sumdata::GeometryConfigurationInfo::GeometryConfigurationInfo
+  (GeometryConfigurationInfo const& from)
+  : dataVersion(from.dataVersion)
+  , geometryServiceConfiguration(from.geometryServiceConfiguration)
+  , detectorName(from.detectorName)
+  , compressedServiceConfiguration(from.compressedServiceConfiguration)
+  {}
+
+
+// -----------------------------------------------------------------------------
+sumdata::GeometryConfigurationInfo&
+sumdata::GeometryConfigurationInfo::operator=
+  (GeometryConfigurationInfo const& from)
+{
+  if (&from == this) return *this;
+  dataVersion = from.dataVersion;
+  geometryServiceConfiguration = from.geometryServiceConfiguration;
+  detectorName = from.detectorName;
+  compressedServiceConfiguration = from.compressedServiceConfiguration;
+  fCache.reset();
+  return *this;
+} // sumdata::GeometryConfigurationInfo::operator=()
+
+
+// -----------------------------------------------------------------------------
+std::string const&
+sumdata::GeometryConfigurationInfo::serviceConfiguration() const {
+  
+  if (!isConfigurationCompressed()) return geometryServiceConfiguration;
+  
+  details::GeometryConfigurationCache& decoded = cache();
+  std::call_once(decoded.decoded, [this, &decoded](){
+      decoded.configuration
+        = decompressConfiguration(compressedServiceConfiguration);
+    });
+  return decoded.configuration;
+  
+} // sumdata::GeometryConfigurationInfo::serviceConfiguration()
+
+
+// -----------------------------------------------------------------------------
+fhicl::ParameterSet const&
+sumdata::GeometryConfigurationInfo::serviceParameters() const {
+  
+  details::GeometryConfigurationCache& parsed = cache();
+  std::call_once(parsed.parsed, [this, &parsed](){
+      parsed.parameters = fhicl::ParameterSet::make(serviceConfiguration());
+    });
+  return parsed.parameters;
+  
+} // sumdata::GeometryConfigurationInfo::serviceParameters()
+
+
+// -----------------------------------------------------------------------------
+sumdata::ContentDigest const&
+sumdata::GeometryConfigurationInfo::contentDigest() const {
+  
+  details::GeometryConfigurationCache& digested = cache();
+  std::call_once(digested.digested, [this, &digested](){
+      digested.digest = geometryConfigurationDigest(*this);
+    });
+  return digested.digest;
+  
+} // sumdata::GeometryConfigurationInfo::contentDigest()
+
+
+// -----------------------------------------------------------------------------
+void sumdata::GeometryConfigurationInfo::setServiceConfiguration
+  (std::string config, bool compress /* = false */)
+{
+  fCache.reset();
+  if (compress) {
+    compressedServiceConfiguration = compressConfiguration(config);
+    geometryServiceConfiguration.clear();
+    if (dataVersion < DataVersion_t{ 3 }) dataVersion = 3;
+  }
+  else {
+    compressedServiceConfiguration.clear();
+    geometryServiceConfiguration = std::move(config);
+  }
+} // sumdata::GeometryConfigurationInfo::setServiceConfiguration()
+
+
+// -----------------------------------------------------------------------------
+sumdata::details::GeometryConfigurationCache&
+sumdata::GeometryConfigurationInfo::cache() const {
+  
+  // the first thread to install a cache wins; the others use that one
+  auto current = std::atomic_load(&fCache);
+  if (!current) {
+    auto fresh = std::make_shared<details::GeometryConfigurationCache>();
+    if (std::atomic_compare_exchange_strong(&fCache, &current, fresh))
+      current = std::move(fresh);
+  }
+  return *current;
+  
+} // sumdata::GeometryConfigurationInfo::cache()
 
 
 // -----------------------------------------------------------------------------
@@ -36,12 +242,19 @@ std::ostream& sumdata::operator<<
     out
       << "\nFull configuration:"
       << "\n" << std::string(80, '-')
-      << "\n" << info.geometryServiceConfiguration
+      << "\n" << info.serviceConfiguration()
       << "\n" << std::string(80, '-')
       ;
   }
   
-  if (info.dataVersion > sumdata::GeometryConfigurationInfo::DataVersion_t{2}) {
+  if (info.dataVersion >= sumdata::GeometryConfigurationInfo::DataVersion_t{3}
+    && info.isConfigurationCompressed()
+  ) {
+    out << "\n(configuration stored compressed in "
+      << info.compressedServiceConfiguration.size() << " bytes)";
+  }
+  
+  if (info.dataVersion > sumdata::GeometryConfigurationInfo::DataVersion_t{3}) {
     out
       << "\n[this version of code can't fully decode further information]";
   }
@@ -11,7 +11,9 @@
 #define LARCOREOBJ_SUMMARYDATA_GEOMETRYCONFIGURATIONINFO_H
 
 // C/C++ standard library
+#include <vector>
 #include <string>
+#include <memory> // std::shared_ptr
 #include <iosfwd>
 
 
@@ -19,8 +21,14 @@
 namespace sumdata {
   struct GeometryConfigurationInfo;
   std::ostream& operator<< (std::ostream&, GeometryConfigurationInfo const&);
+  
+  struct ContentDigest;
+  
+  namespace details { struct GeometryConfigurationCache; }
 } // namespace sumdata
 
+namespace fhicl { class ParameterSet; }
+
 /**
  * @brief  Description of the current configuration of detector geometry.
  * 
@@ -52,7 +60,22 @@ namespace sumdata {
  *     * detector name (`geo::Geometry::DetectorName()`)
  * 2. includes version 1 information and:
  *     * the configuration of `geo::Geometry` service as a FHiCL string
+ * 3. includes version 2 information, but the configuration may be stored
+ *    compressed (zlib) in `compressedServiceConfiguration` instead of as plain
+ *    text in `geometryServiceConfiguration`
  * 
+ * The configuration should be accessed via `serviceConfiguration()`, which
+ * supports all versions. A compressed configuration is decompressed only on
+ * the first access, and the result is cached; copies of this object start
+ * with an empty cache of their own, so they can be modified. Likewise,
+ * `serviceParameters()` parses the configuration only on its first call, so
+ * that looking up a single parameter, e.g.
+ * `info.serviceParameters().get<std::string>("GDML")`, does not require
+ * a full parsing each time, and `contentDigest()` digests the content only on
+ * its first call. Use `setServiceConfiguration()` to change the
+ * configuration:
+ * changing the data members of an object directly after the first access is
+ * not supported (changing them in a new copy is).
  * 
  */
 struct sumdata::GeometryConfigurationInfo {
@@ -66,16 +89,88 @@ struct sumdata::GeometryConfigurationInfo {
   /// Version of the data in this object (`0` is invalid version).
   DataVersion_t dataVersion = InvalidDataVersion;
   
+  /// Constructor: invalid data, no configuration.
+  GeometryConfigurationInfo() = default;
+  
+  /// Copy constructor: copies the data, but not the cache.
+  GeometryConfigurationInfo(GeometryConfigurationInfo const& from);
+  
+  /// Move constructor: the cache moves along with the data.
+  GeometryConfigurationInfo(GeometryConfigurationInfo&&) = default;
+  
+  /// Copy assignment: copies the data and discards the current cache.
+  GeometryConfigurationInfo& operator= (GeometryConfigurationInfo const& from);
+  
+  /// Move assignment: the cache moves along with the data.
+  GeometryConfigurationInfo& operator= (GeometryConfigurationInfo&&) = default;
+  
   /// `geo::Geometry` service configuration, as FHiCL table.
   std::string geometryServiceConfiguration;
   
   ///< Name of the geometry (`geo::GeometryCore::DetectorName()`).
   std::string detectorName;
   
+  /// `geo::Geometry` service configuration, compressed (version 3, if any).
+  std::vector<unsigned char> compressedServiceConfiguration;
+  
   
   /// Protocol: whether the data content is valid.
   bool isDataValid() const noexcept { return dataVersion != InvalidDataVersion; }
   
+  /// Returns whether the service configuration is stored compressed.
+  bool isConfigurationCompressed() const noexcept
+    { return !compressedServiceConfiguration.empty(); }
+  
+  /**
+   * @brief Returns the `geo::Geometry` service configuration as FHiCL table.
+   * @throw std::runtime_error if the compressed configuration is corrupted
+   * 
+   * If the configuration is stored compressed, it is decompressed on the first
+   * call and the same string is returned on all following ones.
+   */
+  std::string const& serviceConfiguration() const;
+  
+  /**
+   * @brief Returns the `geo::Geometry` service configuration, parsed.
+   * @throw fhicl::exception if the configuration is not valid FHiCL
+   * @see `serviceConfiguration()`
+   * 
+   * The configuration is parsed on the first call, and the same parameter set
+   * is returned on all following ones.
+   */
+  fhicl::ParameterSet const& serviceParameters() const;
+  
+  /**
+   * @brief Returns the digest of the content of this configuration.
+   * @throw std::runtime_error if the compressed configuration is corrupted
+   * @see `sumdata::geometryConfigurationDigest()`
+   * 
+   * The digest is computed on the first call, and the same value is returned
+   * on all following ones.
+   */
+  ContentDigest const& contentDigest() const;
+  
+  /**
+   * @brief Sets the `geo::Geometry` service configuration.
+   * @param config the configuration, as FHiCL table
+   * @param compress whether to store the configuration compressed
+   * 
+   * If `compress` is `true`, the configuration is stored only in
+   * `compressedServiceConfiguration`, `geometryServiceConfiguration` is left
+   * empty and the data version is raised to `3` if lower: code reading
+   * `geometryServiceConfiguration` directly must then move to
+   * `serviceConfiguration()`.
+   */
+  void setServiceConfiguration(std::string config, bool compress = false);
+  
+  private:
+  
+  /// Transient cache of the decoded and parsed configuration.
+  mutable std::shared_ptr<details::GeometryConfigurationCache> fCache; //!
+  
+  /// Returns the cache, creating it if needed.
+  details::GeometryConfigurationCache& cache() const;
+  
 }; // sumdata::GeometryConfigurationInfo
 
 
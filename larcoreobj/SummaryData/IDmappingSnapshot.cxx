@@ -0,0 +1,437 @@
+/**
+ * @file   larcoreobj/SummaryData/IDmappingSnapshot.cxx
+ * @brief  Memory-mapped binary snapshot of readout/geometry ID mapping tables.
+ * @see    larcoreobj/SummaryData/IDmappingSnapshot.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/IDmappingSnapshot.h"
+
+// C/C++ standard library
+#include <fstream>
+#include <algorithm> // std::is_sorted()
+#include <stdexcept> // std::runtime_error
+#include <string_view>
+#include <limits> // std::numeric_limits<>
+#include <utility> // std::exchange()
+#include <cstdio> // std::rename(), std::remove()
+#include <cstring> // std::memcpy(), std::memcmp(), std::strerror()
+#include <cerrno>
+
+// POSIX
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <fcntl.h> // open()
+#include <unistd.h> // close()
+
+
+namespace {
+
+  /// Magic string at the start of the file.
+  constexpr char Magic[8] = { 'L', 'A', 'R', 'I', 'D', 'M', 'A', 'P' };
+
+  /// Byte order tag, as written by the native platform.
+  constexpr std::uint32_t EndianTag = 0x01020304U;
+
+  /// Byte order tag, as read from a platform with swapped byte order.
+  constexpr std::uint32_t SwappedEndianTag = 0x04030201U;
+
+  /// Alignment of each table in the file.
+  constexpr std::size_t SectionAlignment = 8U;
+
+  /// Tables in the file, in the order they are written.
+  enum Section: unsigned int {
+    WireLayout,      ///< Extents of the wire layout (4 `std::uint64_t`).
+    WireOffsets,     ///< Offsets of the wires of each channel.
+    WireKeys,        ///< Packed keys of the wires of all channels.
+    WireChannels,    ///< Channel of each wire, by dense wire index.
+    ROPlayout,       ///< Extents of the readout plane layout.
+    PlaneLayout,     ///< Extents of the wire plane layout.
+    ROPplaneOffsets, ///< Offsets of the planes of each readout plane.
+    ROPplaneKeys,    ///< Packed keys of the planes of all readout planes.
+    PlaneROPoffsets, ///< Offsets of the readout planes of each plane.
+    PlaneROPkeys,    ///< Packed keys of the readout planes of all planes.
+    NSections
+  }; // Section
+
+  /// Location of a table in the file.
+  struct SectionInfo {
+    std::uint64_t offset; ///< Offset from the start of the file, in bytes.
+    std::uint64_t count; ///< Number of elements.
+  }; // SectionInfo
+
+  /// Header of the file.
+  struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t endianTag;
+    std::uint64_t geometryDigest[2]; ///< Low and high 64 bits.
+    std::uint64_t contentDigest[2]; ///< Low and high 64 bits.
+    std::uint64_t fileSize;
+    SectionInfo sections[NSections];
+  }; // FileHeader
+
+  static_assert(sizeof(FileHeader) % SectionAlignment == 0U);
+
+
+  /// Returns the digest of the tables (all the file after the header).
+  sumdata::ContentDigest contentDigest(char const* data, std::size_t size) {
+    return sumdata::ContentDigest::of
+      ({ data + sizeof(FileHeader), size - sizeof(FileHeader) });
+  } // contentDigest()
+
+
+  // --- BEGIN -- Writing ------------------------------------------------------
+  /// Collects the content of the file.
+  class SnapshotBuffer {
+
+  public:
+
+    SnapshotBuffer(): fData(sizeof(FileHeader), '\0') {}
+
+    /// Appends `count` elements from `data` as table `section`.
+    template <typename T>
+    void append(Section section, T const* data, std::size_t count)
+      {
+        fData.resize
+          ((fData.size() + SectionAlignment - 1U) & ~(SectionAlignment - 1U));
+        fHeader.sections[section] = { fData.size(), count };
+        if (count > 0U) {
+          fData.append
+            (reinterpret_cast<char const*>(data), count * sizeof(T));
+        }
+      }
+
+    /// Appends the extents of `layout` as table `section`.
+    template <std::size_t Levels>
+    void appendLayout(Section section, geo::IDlayout<Levels> const& layout)
+      {
+        std::uint64_t extents[Levels];
+        for (std::size_t level = 0U; level < Levels; ++level)
+          extents[level] = layout.extent(level);
+        append(section, extents, Levels);
+      }
+
+    /// Appends `table` as tables `offsets` and `keys`.
+    template <typename ID>
+    void appendTable(
+      Section offsets, Section keys, geo::PackedIDcsrView<ID> const& table
+      )
+      {
+        if (table.offsets()) {
+          append(offsets, table.offsets(), table.nRows() + 1U);
+        }
+        else {
+          geo::CSRoffset_t const noRows = 0U;
+          append(offsets, &noRows, 1U);
+        }
+        append(keys, table.keys(), table.nValues());
+      }
+
+    /// Completes the header and returns the content of the file.
+    std::string const& finish(sumdata::ContentDigest const& geometryDigest)
+      {
+        std::memcpy(fHeader.magic, Magic, sizeof(Magic));
+        fHeader.version = sumdata::IDmappingSnapshot::Version;
+        fHeader.endianTag = EndianTag;
+        fHeader.geometryDigest[0] = geometryDigest.low;
+        fHeader.geometryDigest[1] = geometryDigest.high;
+        sumdata::ContentDigest const content
+          = contentDigest(fData.data(), fData.size());
+        fHeader.contentDigest[0] = content.low;
+        fHeader.contentDigest[1] = content.high;
+        fHeader.fileSize = fData.size();
+        std::memcpy(fData.data(), &fHeader, sizeof(FileHeader));
+        return fData;
+      }
+
+  private:
+
+    FileHeader fHeader {}; ///< The header, completed by `finish()`.
+    std::string fData; ///< The whole content of the file.
+
+  }; // class SnapshotBuffer
+
+  // --- END -- Writing --------------------------------------------------------
+
+
+  // --- BEGIN -- Reading ------------------------------------------------------
+  /// Throws a `std::runtime_error` about the snapshot in `path`.
+  [[noreturn]] void snapshotError
+    (std::string const& path, std::string const& message)
+  {
+    throw std::runtime_error
+      ("sumdata::IDmappingSnapshot: '" + path + "': " + message);
+  } // snapshotError()
+
+
+  /// Reads the tables of a mapped file, checking they are in the file.
+  class SnapshotReader {
+
+  public:
+
+    SnapshotReader
+      (std::string const& path, char const* data, std::size_t size)
+      : fPath(path), fData(data), fSize(size)
+      { std::memcpy(&fHeader, fData, sizeof(FileHeader)); }
+
+    FileHeader const& header() const { return fHeader; }
+
+    /// Returns the data of table `section`, which must have `T` elements.
+    template <typename T>
+    T const* table(Section section) const
+      {
+        SectionInfo const& info = fHeader.sections[section];
+        if ((info.offset % SectionAlignment != 0U)
+          || (info.offset < sizeof(FileHeader)) || (info.offset > fSize)
+          || (info.count > (fSize - info.offset) / sizeof(T))
+        ) {
+          snapshotError(fPath, "table #" + std::to_string(section)
+            + " is not within the file");
+        }
+        return reinterpret_cast<T const*>(fData + info.offset);
+      }
+
+    /// Returns the number of elements of table `section`.
+    std::size_t count(Section section) const
+      { return fHeader.sections[section].count; }
+
+    /// Returns the layout in table `section`.
+    template <std::size_t Levels>
+    geo::IDlayout<Levels> layout(Section section) const
+      {
+        if (count(section) != Levels) {
+          snapshotError(fPath, "table #" + std::to_string(section) + " has "
+            + std::to_string(count(section)) + " levels instead of "
+            + std::to_string(Levels));
+        }
+        std::uint64_t const* extents = table<std::uint64_t>(section);
+        typename geo::IDlayout<Levels>::Extents_t layoutExtents;
+        std::size_t size = 1U; // checked not to wrap, unlike `IDlayout::size()`
+        for (std::size_t level = 0U; level < Levels; ++level) {
+          std::uint64_t const extent = extents[level];
+          if (extent >= geo::PackedIDinvalidIndex) {
+            snapshotError(fPath, "table #" + std::to_string(section)
+              + " has extent " + std::to_string(extent) + " on level "
+              + std::to_string(level));
+          }
+          if ((extent > 0U)
+            && (size > std::numeric_limits<std::size_t>::max() / extent)
+          ) {
+            snapshotError(fPath, "table #" + std::to_string(section)
+              + " describes a layout too large");
+          }
+          size *= extent;
+          layoutExtents[level] = extent;
+        }
+        return { layoutExtents };
+      }
+
+    /// Returns the CSR table in `offsets` and `keys` tables, with `nRows`.
+    template <typename ID>
+    geo::PackedIDcsrView<ID> csrTable
+      (Section offsets, Section keys, std::size_t nRows) const
+      {
+        geo::CSRoffset_t const* offsetData
+          = table<geo::CSRoffset_t>(offsets);
+        PackedIDkey_t const* keyData = table<PackedIDkey_t>(keys);
+        // non-decreasing offsets keep all the rows within the key table
+        if ((count(offsets) != nRows + 1U) || (offsetData[0] != 0U)
+          || (offsetData[nRows] != count(keys))
+          || !std::is_sorted(offsetData, offsetData + nRows + 1U)
+        ) {
+          snapshotError(fPath, "inconsistent tables #"
+            + std::to_string(offsets) + " and #" + std::to_string(keys));
+        }
+        return { offsetData, nRows, keyData };
+      }
+
+  private:
+
+    using PackedIDkey_t = geo::PackedIDkey_t;
+
+    std::string const& fPath; ///< Path of the file (for messages).
+    char const* fData; ///< Start of the file.
+    std::size_t fSize; ///< Size of the file.
+    FileHeader fHeader; ///< Copy of the header.
+
+  }; // class SnapshotReader
+
+  // --- END -- Reading --------------------------------------------------------
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+// ---  sumdata::IDmappingSnapshot
+// -----------------------------------------------------------------------------
+sumdata::IDmappingSnapshot::IDmappingSnapshot(
+  std::string const& path, ContentDigest const& geometryDigest,
+  bool checkContent /* = false */
+) {
+  int const fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) snapshotError(path, std::strerror(errno));
+
+  struct stat fileInfo;
+  if (::fstat(fd, &fileInfo) != 0) {
+    int const error = errno;
+    ::close(fd);
+    snapshotError(path, std::strerror(error));
+  }
+  std::size_t const size = fileInfo.st_size;
+  if (size < sizeof(FileHeader)) {
+    ::close(fd);
+    snapshotError(path, "too short (" + std::to_string(size) + " bytes)");
+  }
+
+  void* const data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  int const error = errno;
+  ::close(fd); // the mapping stays valid
+  if (data == MAP_FAILED) snapshotError(path, std::strerror(error));
+  fData = data;
+  fSize = size;
+
+  try {
+    SnapshotReader const reader
+      { path, static_cast<char const*>(fData), fSize };
+    FileHeader const& header = reader.header();
+
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0)
+      snapshotError(path, "not an ID mapping snapshot");
+    if (header.endianTag == SwappedEndianTag)
+      snapshotError(path, "written on a platform with different byte order");
+    if (header.endianTag != EndianTag)
+      snapshotError(path, "invalid byte order tag");
+    if ((header.version == 0U) || (header.version > Version)) {
+      snapshotError(path, "unsupported format version "
+        + std::to_string(header.version));
+    }
+    if (header.fileSize != fSize) {
+      snapshotError(path, "expected " + std::to_string(header.fileSize)
+        + " bytes, found " + std::to_string(fSize));
+    }
+
+    fGeometryDigest
+      = ContentDigest{ header.geometryDigest[0], header.geometryDigest[1] };
+    if (fGeometryDigest != geometryDigest) {
+      snapshotError(path, "snapshot of geometry configuration "
+        + fGeometryDigest.toString() + ", while " + geometryDigest.toString()
+        + " is required");
+    }
+
+    if (checkContent
+      && (contentDigest(static_cast<char const*>(fData), fSize)
+        != ContentDigest{ header.contentDigest[0], header.contentDigest[1] })
+    ) {
+      snapshotError(path, "content is corrupted");
+    }
+
+    readout::WireLayout const wireLayout
+      = reader.layout<4U>(WireLayout);
+    if (reader.count(WireOffsets) == 0U)
+      snapshotError(path, "no channel table");
+    auto const wireTable = reader.csrTable<geo::WireID>
+      (WireOffsets, WireKeys, reader.count(WireOffsets) - 1U);
+    if (reader.count(WireChannels) != wireLayout.size())
+      snapshotError(path, "wrong size of the wire table");
+    fChannelWires = readout::ChannelWireMappingView{
+      wireTable, wireLayout, reader.table<raw::ChannelID_t>(WireChannels)
+      };
+
+    readout::ROPlayout const ropLayout = reader.layout<3U>(ROPlayout);
+    readout::PlaneLayout const planeLayout = reader.layout<3U>(PlaneLayout);
+    fROPplanes = readout::ROPplaneMappingView{
+      ropLayout, planeLayout,
+      reader.csrTable<geo::PlaneID>
+        (ROPplaneOffsets, ROPplaneKeys, ropLayout.size()),
+      reader.csrTable<readout::ROPID>
+        (PlaneROPoffsets, PlaneROPkeys, planeLayout.size())
+      };
+  }
+  catch (...) {
+    unmap();
+    throw;
+  }
+
+} // sumdata::IDmappingSnapshot::IDmappingSnapshot()
+
+
+// -----------------------------------------------------------------------------
+sumdata::IDmappingSnapshot::IDmappingSnapshot
+  (IDmappingSnapshot&& from) noexcept
+  : fData(std::exchange(from.fData, nullptr))
+  , fSize(std::exchange(from.fSize, 0U))
+  , fGeometryDigest(from.fGeometryDigest)
+  , fChannelWires(std::exchange(from.fChannelWires, {}))
+  , fROPplanes(std::exchange(from.fROPplanes, {}))
+{}
+
+
+// -----------------------------------------------------------------------------
+sumdata::IDmappingSnapshot& sumdata::IDmappingSnapshot::operator=
+  (IDmappingSnapshot&& from) noexcept
+{
+  if (this != &from) {
+    unmap();
+    fData = std::exchange(from.fData, nullptr);
+    fSize = std::exchange(from.fSize, 0U);
+    fGeometryDigest = from.fGeometryDigest;
+    fChannelWires = std::exchange(from.fChannelWires, {});
+    fROPplanes = std::exchange(from.fROPplanes, {});
+  }
+  return *this;
+} // sumdata::IDmappingSnapshot::operator=()
+
+
+// -----------------------------------------------------------------------------
+sumdata::IDmappingSnapshot::~IDmappingSnapshot() { unmap(); }
+
+
+// -----------------------------------------------------------------------------
+void sumdata::IDmappingSnapshot::write(
+  std::string const& path, ContentDigest const& geometryDigest,
+  readout::ChannelWireMappingView const& channelWires,
+  readout::ROPplaneMappingView const& ROPplanes
+) {
+  SnapshotBuffer buffer;
+  buffer.appendLayout(WireLayout, channelWires.wireLayout());
+  buffer.appendTable(WireOffsets, WireKeys, channelWires.wireTable());
+  buffer.append(WireChannels, channelWires.channelTable(),
+    channelWires.channelTable()? channelWires.wireLayout().size(): 0U);
+  buffer.appendLayout(ROPlayout, ROPplanes.ropLayout());
+  buffer.appendLayout(PlaneLayout, ROPplanes.planeLayout());
+  buffer.appendTable(ROPplaneOffsets, ROPplaneKeys, ROPplanes.planeTable());
+  buffer.appendTable(PlaneROPoffsets, PlaneROPkeys, ROPplanes.ROPtable());
+  std::string const& content = buffer.finish(geometryDigest);
+
+  // write a temporary file and move it in place, so that readers never see
+  // an incomplete snapshot
+  std::string const tempPath = path + ".tmp";
+  {
+    std::ofstream out { tempPath, std::ios::binary | std::ios::trunc };
+    out.write(content.data(), content.size());
+    out.close();
+    if (!out) {
+      std::remove(tempPath.c_str());
+      snapshotError(tempPath, "can't write the snapshot");
+    }
+  }
+  if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+    int const error = errno;
+    std::remove(tempPath.c_str());
+    snapshotError(path, std::strerror(error));
+  }
+
+} // sumdata::IDmappingSnapshot::write()
+
+
+// -----------------------------------------------------------------------------
+void sumdata::IDmappingSnapshot::unmap() noexcept {
+  if (!fData) return;
+  ::munmap(const_cast<void*>(fData), fSize);
+  fData = nullptr;
+  fSize = 0U;
+} // sumdata::IDmappingSnapshot::unmap()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,158 @@
+/**
+ * @file   larcoreobj/SummaryData/IDmappingSnapshot.h
+ * @brief  Memory-mapped binary snapshot of readout/geometry ID mapping tables.
+ * @see    larcoreobj/SummaryData/IDmappingSnapshot.cxx
+ *
+ * This library depends on standard C++ and POSIX (`mmap()`).
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_IDMAPPINGSNAPSHOT_H
+#define LARCOREOBJ_SUMMARYDATA_IDMAPPINGSNAPSHOT_H
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationDigest.h"
+#include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_geo_mapping.h"
+
+// C/C++ standard library
+#include <string>
+#include <cstdint> // std::uint32_t
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace sumdata {
+
+  /**
+   * @brief Read-only snapshot of ID mapping tables, mapped from a file.
+   *
+   * Building the mappings between channels and wires and between readout and
+   * wire planes requires querying the geometry for each element. The
+   * resulting tables (`readout::ChannelWireMapping` and
+   * `readout::ROPplaneMapping`) are flat arrays, which can be saved with
+   * `write()` into a file and used later directly from that file, mapped in
+   * memory, without any parsing:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * sumdata::IDmappingSnapshot const snapshot { path, geometryInfo };
+   * readout::ChannelWireMappingView const channelWires
+   *   = snapshot.channelWireMapping();
+   *
+   * for (geo::WireID const& wire: channelWires.wires(channel)) { ... }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The views returned by this object refer to the mapped memory and are
+   * valid only as long as this object exists.
+   *
+   * The file starts with a header, which includes:
+   * * a magic string (`"LARIDMAP"`) and the format version (`Version`);
+   * * a tag of the byte order of the writing platform: the file is written in
+   *   the native byte order and it can be used in place only on platforms with
+   *   the same byte order;
+   * * the digest of the geometry configuration the tables were extracted from
+   *   (`sumdata::geometryConfigurationDigest()`);
+   * * the digest of the content of the tables;
+   * * the location and size of each table.
+   *
+   * Opening a snapshot checks the header: a snapshot from a different
+   * geometry configuration is rejected. The extents of the layouts are also
+   * checked to be valid indices, and the offsets of the tables to be
+   * non-decreasing and within their key tables, so that a damaged file can't
+   * make the views read outside of it. The content digest
+   * is checked only on request, since it requires reading the whole file.
+   */
+  class IDmappingSnapshot {
+
+  public:
+
+    /// Version of the file format written by this code.
+    static constexpr std::uint32_t Version = 1U;
+
+    /**
+     * @brief Maps the snapshot in the specified file.
+     * @param path path of the snapshot file
+     * @param geometryDigest digest of the expected geometry configuration
+     * @param checkContent whether to verify the digest of the whole content
+     * @throw std::runtime_error if the file can't be mapped, is not a valid
+     *                           snapshot or it is for another geometry
+     */
+    IDmappingSnapshot(
+      std::string const& path, ContentDigest const& geometryDigest,
+      bool checkContent = false
+      );
+
+    /// Maps the snapshot in `path` for the geometry configuration `info`.
+    IDmappingSnapshot(
+      std::string const& path, GeometryConfigurationInfo const& info,
+      bool checkContent = false
+      )
+      : IDmappingSnapshot
+        (path, geometryConfigurationDigest(info), checkContent)
+      {}
+
+    IDmappingSnapshot(IDmappingSnapshot const&) = delete;
+    IDmappingSnapshot& operator= (IDmappingSnapshot const&) = delete;
+    IDmappingSnapshot(IDmappingSnapshot&& from) noexcept;
+    IDmappingSnapshot& operator= (IDmappingSnapshot&& from) noexcept;
+
+    /// Unmaps the file.
+    ~IDmappingSnapshot();
+
+    /// Returns the digest of the geometry configuration of the snapshot.
+    ContentDigest const& geometryDigest() const { return fGeometryDigest; }
+
+    /// Returns the size of the mapped file, in bytes.
+    std::size_t size() const { return fSize; }
+
+    /// Returns the mapping between channels and wires.
+    readout::ChannelWireMappingView const& channelWireMapping() const
+      { return fChannelWires; }
+
+    /// Returns the mapping between readout planes and wire planes.
+    readout::ROPplaneMappingView const& ROPplaneMapping() const
+      { return fROPplanes; }
+
+    /**
+     * @brief Writes a snapshot of the specified mappings into a file.
+     * @param path path of the snapshot file (overwritten if existing)
+     * @param geometryDigest digest of the geometry configuration
+     * @param channelWires the mapping between channels and wires
+     * @param ROPplanes the mapping between readout planes and wire planes
+     * @throw std::runtime_error if the file can't be written
+     */
+    static void write(
+      std::string const& path, ContentDigest const& geometryDigest,
+      readout::ChannelWireMappingView const& channelWires,
+      readout::ROPplaneMappingView const& ROPplanes
+      );
+
+    /// Writes a snapshot for the geometry configuration `info`.
+    static void write(
+      std::string const& path, GeometryConfigurationInfo const& info,
+      readout::ChannelWireMappingView const& channelWires,
+      readout::ROPplaneMappingView const& ROPplanes
+      )
+      {
+        write
+          (path, geometryConfigurationDigest(info), channelWires, ROPplanes);
+      }
+
+  private:
+
+    void const* fData = nullptr; ///< Start of the mapped file.
+    std::size_t fSize = 0U; ///< Size of the mapped file.
+
+    ContentDigest fGeometryDigest; ///< Digest of the geometry configuration.
+
+    readout::ChannelWireMappingView fChannelWires; ///< Channel/wire mapping.
+    readout::ROPplaneMappingView fROPplanes; ///< ROP/plane mapping.
+
+    /// Unmaps the file, if mapped.
+    void unmap() noexcept;
+
+  }; // class IDmappingSnapshot
+
+} // namespace sumdata
+
+
+// -----------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SUMMARYDATA_IDMAPPINGSNAPSHOT_H
@@ -0,0 +1,55 @@
+/**
+ * @file   larcoreobj/SummaryData/InternedString.cxx
+ * @brief  Handle to a string stored once for the whole process.
+ * @see    larcoreobj/SummaryData/InternedString.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/InternedString.h"
+
+// C/C++ standard library
+#include <unordered_set>
+#include <shared_mutex>
+#include <mutex> // std::unique_lock
+
+
+namespace {
+
+  /// The process-wide table. Elements of a node-based set never move.
+  struct InternTable {
+    std::unordered_set<std::string> values;
+    mutable std::shared_mutex lock;
+  }; // struct InternTable
+
+  /// Returns the table, created on first use (and never destroyed, so that
+  /// handles stay valid during static destruction).
+  InternTable& internTable() {
+    static InternTable* const table = new InternTable;
+    return *table;
+  } // internTable()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+std::string const* sumdata::InternedString::intern(std::string const& value) {
+  InternTable& table = internTable();
+  {
+    std::shared_lock<std::shared_mutex> const readLock { table.lock };
+    auto const it = table.values.find(value);
+    if (it != table.values.end()) return &*it;
+  }
+  std::unique_lock<std::shared_mutex> const writeLock { table.lock };
+  return &*table.values.insert(value).first; // someone may have beaten us
+} // sumdata::InternedString::intern()
+
+
+//------------------------------------------------------------------------------
+std::size_t sumdata::InternedString::tableSize() {
+  InternTable const& table = internTable();
+  std::shared_lock<std::shared_mutex> const readLock { table.lock };
+  return table.values.size();
+} // sumdata::InternedString::tableSize()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,78 @@
+/**
+ * @file   larcoreobj/SummaryData/InternedString.h
+ * @brief  Handle to a string stored once for the whole process.
+ * @see    larcoreobj/SummaryData/InternedString.cxx
+ *
+ * This library depends only on standard C++.
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_INTERNEDSTRING_H
+#define LARCOREOBJ_SUMMARYDATA_INTERNEDSTRING_H
+
+// C/C++ standard library
+#include <string>
+#include <cstddef> // std::size_t
+
+
+namespace sumdata {
+
+  /**
+   * @brief Handle to an immutable string in a process-wide table.
+   *
+   * Each distinct string value is stored in the table only once, the first
+   * time a handle is created for it, and it stays there until the end of the
+   * process. Handles to the same value point to the same stored string, so
+   * that comparing two handles is a pointer comparison, and copying a handle
+   * does not allocate.
+   *
+   * Creating a handle requires a lookup in the table (under a shared lock;
+   * an exclusive lock is taken only to insert a new value). It is meant for
+   * a small number of distinct values which are compared very often, like
+   * detector names.
+   *
+   * A default-constructed handle is invalid and does not refer to any string.
+   */
+  class InternedString {
+
+  public:
+
+    /// Constructor: invalid handle.
+    InternedString() = default;
+
+    /// Constructor: handle to `value` (added to the table if needed).
+    explicit InternedString(std::string const& value)
+      : fValue(intern(value)) {}
+
+    /// Returns whether the handle refers to a string.
+    bool isValid() const noexcept { return fValue != nullptr; }
+
+    /// Returns whether the handle refers to a string.
+    explicit operator bool() const noexcept { return isValid(); }
+
+    /// Returns the string (undefined behaviour if not valid).
+    std::string const& str() const noexcept { return *fValue; }
+
+    /// Returns whether the two handles refer to the same string value.
+    bool operator== (InternedString const& other) const noexcept
+      { return fValue == other.fValue; }
+
+    /// Returns whether the two handles refer to different string values.
+    bool operator!= (InternedString const& other) const noexcept
+      { return fValue != other.fValue; }
+
+    /// Returns the number of distinct strings interned in the process so far.
+    static std::size_t tableSize();
+
+  private:
+
+    std::string const* fValue = nullptr; ///< The interned value.
+
+    /// Returns the address of the interned copy of `value`.
+    static std::string const* intern(std::string const& value);
+
+  }; // class InternedString
+
+} // namespace sumdata
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_INTERNEDSTRING_H
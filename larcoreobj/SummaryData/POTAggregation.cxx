@@ -0,0 +1,204 @@
+/**
+ * @file   larcoreobj/SummaryData/POTAggregation.cxx
+ * @brief  Reproducible aggregation of many `sumdata::POTSummary` objects.
+ * @see    larcoreobj/SummaryData/POTAggregation.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTAggregation.h"
+
+// C/C++ standard library
+#include <thread>
+#include <algorithm> // std::min(), std::max()
+#include <limits> // std::numeric_limits<>
+#include <stdexcept> // std::overflow_error
+#include <string>
+#include <cmath> // std::ldexp()
+
+
+namespace {
+
+  /// Returns `count` as `int`, throwing if it does not fit.
+  int spillCount(long long int count, char const* what) {
+    if ((count > std::numeric_limits<int>::max())
+      || (count < std::numeric_limits<int>::min()))
+    {
+      throw std::overflow_error("sumdata::POTAggregator: "
+        + std::to_string(count) + " " + what + " exceed POTSummary capacity");
+    }
+    return static_cast<int>(count);
+  } // spillCount()
+
+
+  /// Aggregates summaries like `sumdata::POTAggregator`, but summing exactly.
+  struct ExactPOTAggregator {
+
+    sumdata::details::ExactSum totPOT; ///< Total exposure.
+    sumdata::details::ExactSum goodPOT; ///< Exposure with good beam quality.
+    long long int totSpills = 0; ///< Total spill count.
+    long long int goodSpills = 0; ///< Count of good spills.
+
+    void add(sumdata::POTSummary const& summary)
+      {
+        totPOT.add(summary.totpot);
+        goodPOT.add(summary.totgoodpot);
+        totSpills += summary.totspills;
+        goodSpills += summary.goodspills;
+      }
+
+    void combine(ExactPOTAggregator const& other)
+      {
+        totPOT.combine(other.totPOT);
+        goodPOT.combine(other.goodPOT);
+        totSpills += other.totSpills;
+        goodSpills += other.goodSpills;
+      }
+
+    sumdata::POTSummary summary() const
+      {
+        sumdata::POTSummary summary;
+        summary.totpot = totPOT.value();
+        summary.totgoodpot = goodPOT.value();
+        summary.totspills = spillCount(totSpills, "spills");
+        summary.goodspills = spillCount(goodSpills, "good spills");
+        return summary;
+      }
+
+  }; // ExactPOTAggregator
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+void sumdata::details::ExactSum::combine(ExactSum const& other) {
+
+  Limb_t carry = 0U;
+  for (std::size_t i = 0; i < NLimbs; ++i) {
+    Limb_t const sum = fLimbs[i] + other.fLimbs[i];
+    Limb_t const withCarry = sum + carry;
+    carry = ((sum < fLimbs[i]) || (withCarry < sum))? 1U: 0U;
+    fLimbs[i] = withCarry;
+  }
+  fNonFinite += other.fNonFinite;
+
+} // sumdata::details::ExactSum::combine()
+
+
+//------------------------------------------------------------------------------
+double sumdata::details::ExactSum::value() const {
+
+  if (fNonFinite != 0.0) return fNonFinite; // also NaN
+
+  // work on the magnitude
+  bool const negative = (fLimbs.back() >> (LimbBits - 1U)) != 0U;
+  std::array<Limb_t, NLimbs> limbs = fLimbs;
+  if (negative) {
+    Limb_t carry = 1U;
+    for (Limb_t& limb: limbs) {
+      limb = ~limb + carry;
+      carry = (carry && (limb == 0U))? 1U: 0U;
+    }
+  }
+
+  std::size_t top = NLimbs;
+  while ((top > 0U) && (limbs[top - 1U] == 0U)) --top;
+  if (top == 0U) return 0.0;
+  --top;
+
+  double magnitude;
+  if (top == 0U) {
+    // up to 64 bits: the conversion rounds correctly, and the scaling is exact
+    // (the result is either small enough to be exact, or a normal number)
+    magnitude = std::ldexp(static_cast<double>(limbs[0]), -1074);
+  }
+  else {
+    // the 64 most significant bits, and whether any bit below them is set
+    unsigned int bit = LimbBits - 1U;
+    while ((limbs[top] >> bit) == 0U) --bit;
+    Limb_t mostSignificant = limbs[top] << (LimbBits - 1U - bit);
+    Limb_t below = limbs[top - 1U];
+    if (bit < LimbBits - 1U) {
+      mostSignificant |= limbs[top - 1U] >> (bit + 1U);
+      below = limbs[top - 1U] << (LimbBits - 1U - bit);
+    }
+    bool sticky = (below != 0U);
+    for (std::size_t i = 0; !sticky && (i + 1U < top); ++i)
+      sticky = (limbs[i] != 0U);
+
+    // rounding to 53 bits, to nearest with ties to even
+    Limb_t mantissa = mostSignificant >> 11U;
+    Limb_t const rest = mostSignificant & 0x7FFU;
+    if ((rest > 0x400U) || ((rest == 0x400U) && (sticky || (mantissa & 1U))))
+      ++mantissa; // may become 2^53, still exact as double
+
+    // the least significant bit of `mantissa` is bit `position - 52`
+    int const position = static_cast<int>(top * LimbBits + bit);
+    magnitude
+      = std::ldexp(static_cast<double>(mantissa), position - 52 - 1074);
+  }
+
+  return negative? -magnitude: magnitude;
+
+} // sumdata::details::ExactSum::value()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary sumdata::POTAggregator::summary() const {
+  POTSummary summary;
+  summary.totpot = fTotPOT.value();
+  summary.totgoodpot = fGoodPOT.value();
+  summary.totspills = spillCount(fTotSpills, "spills");
+  summary.goodspills = spillCount(fGoodSpills, "good spills");
+  return summary;
+} // sumdata::POTAggregator::summary()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary sumdata::aggregatePOT
+  (POTSummary const* summaries, std::size_t n, unsigned int nThreads /* = 0 */)
+{
+  std::size_t const nBlocks
+    = (n + POTAggregationBlockSize - 1) / POTAggregationBlockSize;
+
+  // one partial result per block, independently of the number of threads
+  std::vector<ExactPOTAggregator> partials(nBlocks);
+  auto aggregateBlocks = [&](std::size_t first, std::size_t step) {
+    for (std::size_t iBlock = first; iBlock < nBlocks; iBlock += step) {
+      std::size_t const begin = iBlock * POTAggregationBlockSize;
+      std::size_t const end = std::min(begin + POTAggregationBlockSize, n);
+      ExactPOTAggregator partial; // local, to avoid sharing cache lines
+      for (std::size_t i = begin; i < end; ++i) partial.add(summaries[i]);
+      partials[iBlock] = partial;
+    } // for blocks
+  }; // aggregateBlocks()
+
+  if (nThreads == 0U)
+    nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  std::size_t const nWorkers = std::min<std::size_t>(nThreads, nBlocks);
+
+  if (nWorkers <= 1U) aggregateBlocks(0U, 1U);
+  else {
+    // blocks are interleaved among the workers; this thread is one of them
+    std::vector<std::thread> workers;
+    workers.reserve(nWorkers - 1U);
+    try {
+      for (std::size_t iWorker = 1U; iWorker < nWorkers; ++iWorker)
+        workers.emplace_back(aggregateBlocks, iWorker, nWorkers);
+    }
+    catch (...) { // failed to start a thread: wait for the others and give up
+      for (std::thread& worker: workers) worker.join();
+      throw;
+    }
+    aggregateBlocks(0U, nWorkers);
+    for (std::thread& worker: workers) worker.join();
+  }
+
+  // combination is exact, hence its order does not matter
+  ExactPOTAggregator total;
+  for (ExactPOTAggregator const& partial: partials) total.combine(partial);
+  return total.summary();
+
+} // sumdata::aggregatePOT()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,282 @@
+/**
+ * @file   larcoreobj/SummaryData/POTAggregation.h
+ * @brief  Reproducible aggregation of many `sumdata::POTSummary` objects.
+ * @see    larcoreobj/SummaryData/POTAggregation.cxx
+ *
+ * This library depends only on standard C++ (and on the threading library).
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_POTAGGREGATION_H
+#define LARCOREOBJ_SUMMARYDATA_POTAGGREGATION_H
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard library
+#include <vector>
+#include <array>
+#include <cmath> // std::abs()
+#include <cstring> // std::memcpy()
+#include <cstdint> // std::uint64_t
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace sumdata::details {
+
+  /**
+   * @brief Sum of floating point values with Neumaier compensation.
+   *
+   * The rounding error of each addition is accumulated separately and added
+   * back when the value is requested. The error of the result is about one
+   * rounding of the total, regardless of the number of addends: for sums of
+   * positive numbers like exposures, the order of the addends affects at most
+   * the last bit of the result, but it is not guaranteed to be irrelevant.
+   */
+  class CompensatedSum {
+
+  public:
+
+    /// Constructor: the sum starts from zero.
+    CompensatedSum() = default;
+
+    /// Constructor: resumes a sum from its state (`sum()`, `compensation()`).
+    CompensatedSum(double sum, double compensation)
+      : fSum(sum), fCompensation(compensation) {}
+
+    /// Adds `value` to the sum.
+    void add(double value)
+      {
+        double const sum = fSum + value;
+        fCompensation += (std::abs(fSum) >= std::abs(value))
+          ? (fSum - sum) + value
+          : (value - sum) + fSum;
+        fSum = sum;
+      }
+
+    /// Adds the content of another sum to this one.
+    void combine(CompensatedSum const& other)
+      { add(other.fSum); add(other.fCompensation); }
+
+    /// Returns the current value of the sum.
+    double value() const { return fSum + fCompensation; }
+
+    /// Returns the uncompensated part of the state of the sum.
+    double sum() const { return fSum; }
+
+    /// Returns the accumulated rounding errors.
+    double compensation() const { return fCompensation; }
+
+  private:
+    double fSum = 0.0; ///< Uncompensated sum.
+    double fCompensation = 0.0; ///< Accumulated rounding errors.
+
+  }; // class CompensatedSum
+
+
+  /**
+   * @brief Exact sum of floating point values.
+   *
+   * The sum is kept as a fixed point integer wide enough for every finite
+   * `double` (with 64 more bits against overflow), so that each addition is
+   * exact. The result is therefore independent of the order of the additions
+   * and of how the addends are split among sums later combined, and `value()`
+   * returns the exact sum rounded once to the nearest `double`.
+   * Infinities and NaN are summed separately and dominate the result.
+   */
+  class ExactSum {
+
+  public:
+
+    /// Adds `value` to the sum.
+    void add(double value);
+
+    /// Adds the content of another sum to this one.
+    void combine(ExactSum const& other);
+
+    /// Returns the sum, rounded to the nearest `double` (ties to even).
+    double value() const;
+
+  private:
+
+    using Limb_t = std::uint64_t; ///< Type of a piece of the sum.
+
+    /// Number of bits of a limb.
+    static constexpr unsigned int LimbBits = 64U;
+
+    /// Number of limbs: 2098 bits cover all doubles, plus room for carries.
+    static constexpr std::size_t NLimbs = 34U;
+
+    /// The sum in units of the smallest denormal, two's complement.
+    std::array<Limb_t, NLimbs> fLimbs {};
+
+    double fNonFinite = 0.0; ///< Sum of the infinite and NaN addends.
+
+    /// Adds (or subtracts if `negative`) `value` shifted by `shift` bits.
+    void addShifted(Limb_t value, unsigned int shift, bool negative);
+
+  }; // class ExactSum
+
+} // namespace sumdata::details
+
+
+// -----------------------------------------------------------------------------
+namespace sumdata {
+
+  /**
+   * @brief Accumulates `sumdata::POTSummary` objects.
+   *
+   * The exposures are summed with compensation
+   * (`sumdata::details::CompensatedSum`) and the spill counters with 64-bit
+   * integers. The result is returned as a `POTSummary` by `summary()`.
+   */
+  class POTAggregator {
+
+  public:
+
+    /// Constructor: nothing aggregated yet.
+    POTAggregator() = default;
+
+    /// Constructor: resumes an aggregation from its state.
+    POTAggregator(
+      details::CompensatedSum totPOT, details::CompensatedSum goodPOT,
+      long long int totSpills, long long int goodSpills
+      )
+      : fTotPOT(totPOT), fGoodPOT(goodPOT)
+      , fTotSpills(totSpills), fGoodSpills(goodSpills)
+      {}
+
+    /// Adds the content of a summary.
+    void add(POTSummary const& summary)
+      {
+        fTotPOT.add(summary.totpot);
+        fGoodPOT.add(summary.totgoodpot);
+        fTotSpills += summary.totspills;
+        fGoodSpills += summary.goodspills;
+      }
+
+    /// Adds the content of another aggregator.
+    void combine(POTAggregator const& other)
+      {
+        fTotPOT.combine(other.fTotPOT);
+        fGoodPOT.combine(other.fGoodPOT);
+        fTotSpills += other.fTotSpills;
+        fGoodSpills += other.fGoodSpills;
+      }
+
+    /// Returns the aggregated summary.
+    /// @throw std::overflow_error if spill counts don't fit `POTSummary`
+    POTSummary summary() const;
+
+    // --- BEGIN -- State of the aggregation -----------------------------------
+    details::CompensatedSum const& totPOT() const { return fTotPOT; }
+    details::CompensatedSum const& goodPOT() const { return fGoodPOT; }
+    long long int totSpills() const { return fTotSpills; }
+    long long int goodSpills() const { return fGoodSpills; }
+    // --- END -- State of the aggregation -------------------------------------
+
+  private:
+    details::CompensatedSum fTotPOT; ///< Total exposure.
+    details::CompensatedSum fGoodPOT; ///< Exposure with good beam quality.
+    long long int fTotSpills = 0; ///< Total spill count.
+    long long int fGoodSpills = 0; ///< Count of good spills.
+
+  }; // class POTAggregator
+
+
+  /// Number of consecutive summaries aggregated serially by `aggregatePOT()`.
+  constexpr std::size_t POTAggregationBlockSize = 4096U;
+
+  /**
+   * @brief Aggregates `n` summaries starting from `summaries`.
+   * @param summaries pointer to the first summary
+   * @param n number of summaries to aggregate
+   * @param nThreads number of threads to use (`0`: hardware concurrency)
+   * @return the aggregated summary
+   * @throw std::overflow_error if spill counts don't fit `POTSummary`
+   *
+   * The summaries are split in blocks of `POTAggregationBlockSize`
+   * consecutive elements, each block is aggregated separately, and the
+   * partial results are combined. The exposures are summed exactly
+   * (`sumdata::details::ExactSum`) and rounded only at the end, so the result
+   * is bit by bit the same for any number of threads and any order of the
+   * summaries, and it is the exact total rounded to the nearest `double`.
+   *
+   * No more threads are started than there are blocks.
+   */
+  POTSummary aggregatePOT
+    (POTSummary const* summaries, std::size_t n, unsigned int nThreads = 0U);
+
+  /// Aggregates all the `summaries` (see the pointer version).
+  POTSummary aggregatePOT
+    (std::vector<POTSummary> const& summaries, unsigned int nThreads = 0U);
+
+} // namespace sumdata
+
+
+// -----------------------------------------------------------------------------
+// --- inline implementation
+// -----------------------------------------------------------------------------
+inline void sumdata::details::ExactSum::add(double value) {
+
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  unsigned int const exponent = (bits >> 52U) & 0x7FFU;
+  Limb_t const fraction = bits & ((Limb_t{ 1U } << 52U) - 1U);
+  bool const negative = (bits >> 63U) != 0U;
+
+  if (exponent == 0x7FFU) fNonFinite += value; // infinity or NaN
+  else if (exponent == 0U) addShifted(fraction, 0U, negative); // denormal
+  else {
+    // value is (2^52 + fraction) * 2^(exponent - 1075),
+    // i.e. (2^52 + fraction) shifted by (exponent - 1) denormal units
+    addShifted
+      (fraction | (Limb_t{ 1U } << 52U), exponent - 1U, negative);
+  }
+
+} // sumdata::details::ExactSum::add()
+
+
+// -----------------------------------------------------------------------------
+inline void sumdata::details::ExactSum::addShifted
+  (Limb_t value, unsigned int shift, bool negative)
+{
+  if (value == 0U) return;
+
+  std::size_t i = shift / LimbBits;
+  unsigned int const bit = shift % LimbBits;
+  Limb_t const low = value << bit;
+  Limb_t const high = (bit == 0U)? 0U: (value >> (LimbBits - bit));
+
+  // the two limbs spanned by the value, then the carry (or borrow)
+  if (negative) {
+    Limb_t const before = fLimbs[i];
+    fLimbs[i] -= low;
+    Limb_t borrow = (fLimbs[i] > before)? 1U: 0U;
+    ++i;
+    Limb_t const subtrahend = high + borrow; // can't wrap: high < 2^63
+    Limb_t const next = fLimbs[i];
+    fLimbs[i] -= subtrahend;
+    borrow = (fLimbs[i] > next)? 1U: 0U;
+    while (borrow && (++i < NLimbs)) borrow = (fLimbs[i]-- == 0U)? 1U: 0U;
+  }
+  else {
+    fLimbs[i] += low;
+    Limb_t carry = (fLimbs[i] < low)? 1U: 0U;
+    ++i;
+    Limb_t const addend = high + carry; // can't wrap: high < 2^63
+    fLimbs[i] += addend;
+    carry = (fLimbs[i] < addend)? 1U: 0U;
+    while (carry && (++i < NLimbs)) carry = (++fLimbs[i] == 0U)? 1U: 0U;
+  }
+
+} // sumdata::details::ExactSum::addShifted()
+
+
+// -----------------------------------------------------------------------------
+inline sumdata::POTSummary sumdata::aggregatePOT
+  (std::vector<POTSummary> const& summaries, unsigned int nThreads /* = 0 */)
+  { return aggregatePOT(summaries.data(), summaries.size(), nThreads); }
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_POTAGGREGATION_H
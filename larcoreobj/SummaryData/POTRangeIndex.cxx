@@ -0,0 +1,321 @@
+/**
+ * @file   larcoreobj/SummaryData/POTRangeIndex.cxx
+ * @brief  Sorted indices of `sumdata::POTSummary` by run and subrun.
+ * @see    larcoreobj/SummaryData/POTRangeIndex.h
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTRangeIndex.h"
+
+// C/C++ standard library
+#include <istream>
+#include <ostream>
+#include <algorithm> // std::lower_bound(), std::stable_sort(), std::equal()
+#include <limits> // std::numeric_limits<>
+#include <stdexcept> // std::invalid_argument, std::runtime_error, ...
+#include <utility> // std::move()
+#include <cstring> // std::memcpy()
+
+
+namespace {
+
+  // --- BEGIN -- Little endian binary I/O -------------------------------------
+  /// Writes the `NBytes` lowest bytes of `value`, least significant first.
+  template <std::size_t NBytes>
+  void writeLE(std::ostream& out, std::uint64_t value) {
+    char bytes[NBytes];
+    for (std::size_t i = 0; i < NBytes; ++i) {
+      bytes[i] = static_cast<char>(value & 0xFFU);
+      value >>= 8U;
+    }
+    out.write(bytes, NBytes);
+  } // writeLE()
+
+  void writeDouble(std::ostream& out, double value) {
+    static_assert(sizeof(double) == sizeof(std::uint64_t));
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeLE<8U>(out, bits);
+  } // writeDouble()
+
+  /// Reads `NBytes` bytes, least significant first.
+  template <std::size_t NBytes>
+  std::uint64_t readLE(std::istream& in) {
+    unsigned char bytes[NBytes];
+    if (!in.read(reinterpret_cast<char*>(bytes), NBytes)) {
+      throw std::runtime_error
+        ("sumdata::readPOTRangeIndex(): unexpected end of data");
+    }
+    std::uint64_t value = 0U;
+    for (std::size_t i = NBytes; i > 0; --i) value = (value << 8U) | bytes[i-1];
+    return value;
+  } // readLE()
+
+  double readDouble(std::istream& in) {
+    std::uint64_t const bits = readLE<8U>(in);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  } // readDouble()
+
+  /// Reads a 32-bit two's complement signed integer.
+  int readInt32(std::istream& in) {
+    std::uint64_t const bits = readLE<4U>(in);
+    return (bits & 0x80000000U)
+      ? static_cast<int>(static_cast<std::int64_t>(bits) - 0x100000000LL)
+      : static_cast<int>(bits);
+  } // readInt32()
+  // --- END -- Little endian binary I/O ---------------------------------------
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+//--- sumdata::POTRangeIndex
+//------------------------------------------------------------------------------
+sumdata::POTRangeIndex::POTRangeIndex
+  (std::vector<Key_t> keys, std::vector<POTSummary> summaries)
+  : fKeys(std::move(keys))
+  , fSummaries(std::move(summaries))
+{
+  if (fKeys.size() != fSummaries.size()) {
+    throw std::invalid_argument("sumdata::POTRangeIndex: "
+      + std::to_string(fKeys.size()) + " keys for "
+      + std::to_string(fSummaries.size()) + " summaries");
+  }
+  buildPrefix();
+} // sumdata::POTRangeIndex::POTRangeIndex()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary const* sumdata::POTRangeIndex::find
+  (Key_t const& key) const
+{
+  auto const it = std::lower_bound(fKeys.begin(), fKeys.end(), key);
+  if ((it == fKeys.end()) || (*it != key)) return nullptr;
+  return &fSummaries[it - fKeys.begin()];
+} // sumdata::POTRangeIndex::find()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary sumdata::POTRangeIndex::sum
+  (Key_t const& first, Key_t const& last) const
+{
+  if (last < first) return {};
+  auto const begin = std::lower_bound(fKeys.begin(), fKeys.end(), first);
+  auto const end = std::upper_bound(begin, fKeys.end(), last);
+  return sumPositions(begin - fKeys.begin(), end - fKeys.begin());
+} // sumdata::POTRangeIndex::sum()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary sumdata::POTRangeIndex::sumRun(RunNumber_t run) const {
+  return sum(
+    Key_t{ run, 0U },
+    Key_t{ run, std::numeric_limits<SubRunNumber_t>::max() }
+    );
+} // sumdata::POTRangeIndex::sumRun()
+
+
+//------------------------------------------------------------------------------
+void sumdata::POTRangeIndex::buildPrefix() {
+
+  for (std::size_t i = 1; i < fKeys.size(); ++i) {
+    if (fKeys[i - 1] < fKeys[i]) continue;
+    throw std::invalid_argument("sumdata::POTRangeIndex: key #"
+      + std::to_string(i) + " (run " + std::to_string(fKeys[i].run)
+      + " subrun " + std::to_string(fKeys[i].subRun)
+      + ") is not sorted or is duplicate");
+  } // for
+
+  fPrefix.clear();
+  fPrefix.reserve(fSummaries.size() + 1U);
+  POTAggregator running;
+  fPrefix.push_back(running);
+  for (POTSummary const& summary: fSummaries) {
+    running.add(summary);
+    fPrefix.push_back(running);
+  }
+
+} // sumdata::POTRangeIndex::buildPrefix()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary sumdata::POTRangeIndex::sumPositions
+  (std::size_t begin, std::size_t end) const
+{
+  if (begin >= end) return {};
+
+  // difference of compensated sums: uncompensated parts are close and their
+  // difference is exact or nearly so, compensations restore the low bits
+  auto const difference = [](
+    details::CompensatedSum const& a, details::CompensatedSum const& b
+  ) {
+    return details::CompensatedSum
+      { a.sum() - b.sum(), a.compensation() - b.compensation() };
+  };
+
+  POTAggregator const& upTo = fPrefix[end];
+  POTAggregator const& before = fPrefix[begin];
+  return POTAggregator{
+    difference(upTo.totPOT(), before.totPOT()),
+    difference(upTo.goodPOT(), before.goodPOT()),
+    upTo.totSpills() - before.totSpills(),
+    upTo.goodSpills() - before.goodSpills()
+    }.summary();
+
+} // sumdata::POTRangeIndex::sumPositions()
+
+
+//------------------------------------------------------------------------------
+//--- sumdata::POTRangeIndexBuilder
+//------------------------------------------------------------------------------
+sumdata::POTRangeIndex sumdata::POTRangeIndexBuilder::build() const {
+
+  // sort by key, keeping the original order of duplicates (for repeatability)
+  std::vector<std::pair<Key_t, POTSummary>> records = fRecords;
+  std::stable_sort(records.begin(), records.end(),
+    [](auto const& a, auto const& b){ return a.first < b.first; });
+
+  std::vector<Key_t> keys;
+  std::vector<POTSummary> summaries;
+  auto iRecord = records.begin();
+  auto const rend = records.end();
+  while (iRecord != rend) {
+    Key_t const key = iRecord->first;
+    POTAggregator aggregator;
+    for (; (iRecord != rend) && (iRecord->first == key); ++iRecord)
+      aggregator.add(iRecord->second);
+    keys.push_back(key);
+    summaries.push_back(aggregator.summary());
+  } // while
+
+  return { std::move(keys), std::move(summaries) };
+
+} // sumdata::POTRangeIndexBuilder::build()
+
+
+//------------------------------------------------------------------------------
+//--- binary I/O
+//------------------------------------------------------------------------------
+void sumdata::writePOTRangeIndex
+  (std::ostream& out, POTRangeIndex const& index)
+{
+  out.write(POTRangeIndexMagic, sizeof(POTRangeIndexMagic));
+  writeLE<4U>(out, POTRangeIndexFormatVersion);
+  writeLE<8U>(out, index.size());
+
+  std::vector<POTRangeIndex::Key_t> const& keys = index.keys();
+  std::vector<POTSummary> const& summaries = index.summaries();
+  for (std::size_t i = 0; i < index.size(); ++i) {
+    writeLE<4U>(out, keys[i].run);
+    writeLE<4U>(out, keys[i].subRun);
+    writeDouble(out, summaries[i].totpot);
+    writeDouble(out, summaries[i].totgoodpot);
+    writeLE<4U>(out, static_cast<std::uint32_t>(summaries[i].totspills));
+    writeLE<4U>(out, static_cast<std::uint32_t>(summaries[i].goodspills));
+  } // for
+
+  if (!out) {
+    throw std::runtime_error
+      ("sumdata::writePOTRangeIndex(): failed to write the index");
+  }
+} // sumdata::writePOTRangeIndex()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTRangeIndex sumdata::readPOTRangeIndex(std::istream& in) {
+
+  char magic[sizeof(POTRangeIndexMagic)];
+  if (!in.read(magic, sizeof(magic))
+    || !std::equal(magic, magic + sizeof(magic), POTRangeIndexMagic))
+  {
+    throw std::runtime_error
+      ("sumdata::readPOTRangeIndex(): data is not a POT index");
+  }
+  std::uint64_t const version = readLE<4U>(in);
+  if (version != POTRangeIndexFormatVersion) {
+    throw std::runtime_error("sumdata::readPOTRangeIndex(): format version "
+      + std::to_string(version) + " not supported (only "
+      + std::to_string(POTRangeIndexFormatVersion) + ")");
+  }
+  std::uint64_t const n = readLE<8U>(in);
+
+  // do not trust the size for memory allocation: data might be truncated
+  std::vector<POTRangeIndex::Key_t> keys;
+  std::vector<POTSummary> summaries;
+  std::size_t const reserve = std::min<std::uint64_t>(n, 1U << 16);
+  keys.reserve(reserve);
+  summaries.reserve(reserve);
+  for (std::uint64_t i = 0; i < n; ++i) {
+    POTRangeIndex::Key_t key;
+    key.run = static_cast<POTRangeIndex::RunNumber_t>(readLE<4U>(in));
+    key.subRun = static_cast<POTRangeIndex::SubRunNumber_t>(readLE<4U>(in));
+    POTSummary summary;
+    summary.totpot = readDouble(in);
+    summary.totgoodpot = readDouble(in);
+    summary.totspills = readInt32(in);
+    summary.goodspills = readInt32(in);
+    keys.push_back(key);
+    summaries.push_back(summary);
+  } // for
+
+  try {
+    return { std::move(keys), std::move(summaries) };
+  }
+  catch (std::invalid_argument const& e) {
+    throw std::runtime_error
+      (std::string{ "sumdata::readPOTRangeIndex(): " } + e.what());
+  }
+
+} // sumdata::readPOTRangeIndex()
+
+
+//------------------------------------------------------------------------------
+//--- sumdata::SampledPOTIndex
+//------------------------------------------------------------------------------
+void sumdata::SampledPOTIndex::addDataset
+  (std::string const& name, POTRangeIndex index)
+{
+  if (hasDataset(name)) {
+    throw std::invalid_argument
+      ("sumdata::SampledPOTIndex: dataset '" + name + "' already present");
+  }
+  fByName.emplace(name, fIndices.size());
+  fNames.push_back(name);
+  fIndices.push_back(std::move(index));
+} // sumdata::SampledPOTIndex::addDataset()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTRangeIndex const* sumdata::SampledPOTIndex::findDataset
+  (std::string const& name) const
+{
+  auto const it = fByName.find(name);
+  return (it == fByName.end())? nullptr: &fIndices[it->second];
+} // sumdata::SampledPOTIndex::findDataset()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTRangeIndex const& sumdata::SampledPOTIndex::dataset
+  (std::string const& name) const
+{
+  POTRangeIndex const* index = findDataset(name);
+  if (!index) {
+    throw std::out_of_range
+      ("sumdata::SampledPOTIndex: no dataset '" + name + "'");
+  }
+  return *index;
+} // sumdata::SampledPOTIndex::dataset()
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary const* sumdata::SampledPOTIndex::find
+  (std::string const& dataset, POTRangeIndex::Key_t const& key) const
+{
+  POTRangeIndex const* index = findDataset(dataset);
+  return index? index->find(key): nullptr;
+} // sumdata::SampledPOTIndex::find()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,332 @@
+/**
+ * @file   larcoreobj/SummaryData/POTRangeIndex.h
+ * @brief  Sorted indices of `sumdata::POTSummary` by run and subrun.
+ * @see    larcoreobj/SummaryData/POTRangeIndex.cxx
+ *
+ * This library depends only on standard C++. The templates accepting subrun
+ * IDs work with `art::SubRunID` and any other type with `run()` and `subRun()`
+ * methods, and they do not require this library to link to _art_.
+ */
+
+#ifndef LARCOREOBJ_SUMMARYDATA_POTRANGEINDEX_H
+#define LARCOREOBJ_SUMMARYDATA_POTRANGEINDEX_H
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTAggregation.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard library
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <tuple> // std::tie()
+#include <utility> // std::pair
+#include <iosfwd> // std::istream, std::ostream
+#include <cstdint> // std::uint32_t
+#include <cstddef> // std::size_t
+
+
+namespace sumdata {
+
+  /**
+   * @brief Index of POT summaries sorted by run and subrun.
+   *
+   * The index is a flat, sorted list of (run, subrun) keys with their
+   * summaries, and the prefix sums of the summaries. Once built, it supports:
+   * * lookup of the summary of a subrun in @f$ O(\log n) @f$ (`find()`);
+   * * sum of the summaries in an inclusive range of subruns, ordered first by
+   *   run and then by subrun, in @f$ O(\log n) @f$ (`sum()`).
+   *
+   * The prefix sums of the exposures are compensated
+   * (`sumdata::details::CompensatedSum`), so that the sum of a small range
+   * does not lose precision to the size of the total.
+   *
+   * The index is not modified after construction, and it can be shared among
+   * threads.
+   */
+  class POTRangeIndex {
+
+  public:
+
+    using RunNumber_t = unsigned int; ///< Type of run number.
+    using SubRunNumber_t = unsigned int; ///< Type of subrun number.
+
+    /// Key of the index: run and subrun numbers.
+    struct Key_t {
+      RunNumber_t run = 0U; ///< Run number.
+      SubRunNumber_t subRun = 0U; ///< Subrun number.
+
+      bool operator< (Key_t const& other) const
+        { return std::tie(run, subRun) < std::tie(other.run, other.subRun); }
+      bool operator== (Key_t const& other) const
+        { return (run == other.run) && (subRun == other.subRun); }
+      bool operator!= (Key_t const& other) const { return !(*this == other); }
+    }; // struct Key_t
+
+    /// Returns the key of the subrun `id` (e.g. an `art::SubRunID`).
+    template <typename SubRunID>
+    static Key_t makeKey(SubRunID const& id)
+      { return { id.run(), id.subRun() }; }
+
+
+    /// Constructor: empty index.
+    POTRangeIndex() = default;
+
+    /**
+     * @brief Constructor: indexes the specified keys and summaries.
+     * @param keys subrun keys, sorted and without duplicates
+     * @param summaries the summary of each of the `keys`
+     * @throw std::invalid_argument if keys are not sorted and unique, or
+     *        their number is different from the one of `summaries`
+     */
+    POTRangeIndex(std::vector<Key_t> keys, std::vector<POTSummary> summaries);
+
+    /// Constructor: indexes the summaries in a map by subrun ID.
+    template <typename SubRunID>
+    explicit POTRangeIndex(std::map<SubRunID, POTSummary> const& summaries);
+
+
+    /// Returns the number of subruns in the index.
+    std::size_t size() const { return fKeys.size(); }
+
+    /// Returns whether the index has no subrun.
+    bool empty() const { return fKeys.empty(); }
+
+    /// Returns the sorted keys of the index.
+    std::vector<Key_t> const& keys() const { return fKeys; }
+
+    /// Returns the summaries, in the same order as `keys()`.
+    std::vector<POTSummary> const& summaries() const { return fSummaries; }
+
+
+    /// Returns the summary of the subrun, `nullptr` if not present.
+    POTSummary const* find(Key_t const& key) const;
+
+    /// Returns the summary of the subrun, `nullptr` if not present.
+    POTSummary const* find(RunNumber_t run, SubRunNumber_t subRun) const
+      { return find(Key_t{ run, subRun }); }
+
+    /**
+     * @brief Returns the sum of the summaries from `first` to `last` included.
+     * @throw std::overflow_error if spill counts don't fit `POTSummary`
+     *
+     * Subruns are ordered by run first, and then by subrun: for example, the
+     * range from run 5 subrun 10 to run 7 subrun 2 includes all of run 6.
+     * Keys not in the index are allowed as range boundaries; if `last` comes
+     * before `first`, the result is empty.
+     */
+    POTSummary sum(Key_t const& first, Key_t const& last) const;
+
+    /// Returns the sum of all the summaries of the run `run`.
+    POTSummary sumRun(RunNumber_t run) const;
+
+    /// Returns the sum of all the summaries in the index.
+    POTSummary total() const { return sumPositions(0U, size()); }
+
+  private:
+
+    std::vector<Key_t> fKeys; ///< Sorted keys.
+    std::vector<POTSummary> fSummaries; ///< Summary of each key.
+
+    /// Aggregation of the summaries before each position (one more entry).
+    std::vector<POTAggregator> fPrefix;
+
+    /// Computes the prefix sums and checks the keys.
+    void buildPrefix();
+
+    /// Returns the sum of summaries in the positions `[begin, end[`.
+    POTSummary sumPositions(std::size_t begin, std::size_t end) const;
+
+  }; // class POTRangeIndex
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Collects subrun summaries in any order into a `POTRangeIndex`.
+   *
+   * Records (run, subrun, summary) are added one by one, in any order, e.g.
+   * while reading many files. Records for the same subrun are aggregated
+   * (with compensated exposure sums). `build()` sorts the records and creates
+   * the index.
+   *
+   * Example:
+   * @code
+   * sumdata::POTRangeIndexBuilder builder;
+   * for (auto const& [ run, subRun, summary ]: records)
+   *   builder.add(run, subRun, summary);
+   * sumdata::POTRangeIndex const index = builder.build();
+   * @endcode
+   */
+  class POTRangeIndexBuilder {
+
+  public:
+
+    using Key_t = POTRangeIndex::Key_t; ///< Type of subrun key.
+
+    /// Adds the summary of the specified subrun.
+    void add(
+      POTRangeIndex::RunNumber_t run, POTRangeIndex::SubRunNumber_t subRun,
+      POTSummary const& summary
+      )
+      { fRecords.emplace_back(Key_t{ run, subRun }, summary); }
+
+    /// Adds the summary of the specified subrun (e.g. an `art::SubRunID`).
+    template <typename SubRunID>
+    void add(SubRunID const& id, POTSummary const& summary)
+      { fRecords.emplace_back(POTRangeIndex::makeKey(id), summary); }
+
+    /// Returns the number of records added so far.
+    std::size_t nRecords() const { return fRecords.size(); }
+
+    /**
+     * @brief Returns an index with all the records added so far.
+     * @throw std::overflow_error if spill counts of a subrun don't fit
+     *        `POTSummary`
+     *
+     * The builder is not modified and can keep collecting records.
+     */
+    POTRangeIndex build() const;
+
+  private:
+
+    std::vector<std::pair<Key_t, POTSummary>> fRecords; ///< Records so far.
+
+  }; // class POTRangeIndexBuilder
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @name Binary files of POT indices
+   *
+   * A `POTRangeIndex` can be saved into a compact binary stream, from which
+   * it is rebuilt (with its prefix sums) much faster than by collecting the
+   * summaries again.
+   *
+   * The format is made of:
+   * * the 8 bytes of `POTRangeIndexMagic`;
+   * * the format version (`POTRangeIndexFormatVersion`), 32-bit;
+   * * the number of subruns, 64-bit;
+   * * for each subrun in key order: run and subrun number (32-bit each),
+   *   total and good exposure (IEEE 754 double precision), total and good
+   *   spill counts (32-bit signed).
+   *
+   * All numbers are stored little endian, independently of the platform.
+   */
+  /// @{
+
+  /// Tag at the beginning of the binary stream of a `POTRangeIndex`.
+  constexpr char POTRangeIndexMagic[8] = { 'L','A','R','P','O','T','I','X' };
+
+  /// Version of the binary format of `POTRangeIndex` being written.
+  constexpr std::uint32_t POTRangeIndexFormatVersion = 1U;
+
+  /// Writes `index` into the binary stream `out`.
+  /// @throw std::runtime_error on write failure
+  void writePOTRangeIndex(std::ostream& out, POTRangeIndex const& index);
+
+  /// Reads and returns a `POTRangeIndex` from the binary stream `in`.
+  /// @throw std::runtime_error if the data is not valid or is truncated
+  POTRangeIndex readPOTRangeIndex(std::istream& in);
+
+  /// @}
+
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Index of POT summaries of sampled datasets.
+   *
+   * This index is built from the content of a `art::Sampled<POTSummary>`,
+   * i.e. `std::map<std::string, std::map<art::SubRunID, POTSummary>>` where
+   * the key of the first map is the name of the dataset.
+   * It holds a `POTRangeIndex` for each dataset, and looks datasets up by name
+   * in constant time.
+   */
+  class SampledPOTIndex {
+
+  public:
+
+    /// Constructor: empty index.
+    SampledPOTIndex() = default;
+
+    /// Constructor: indexes all the datasets in `sampled`.
+    template <typename SubRunID>
+    explicit SampledPOTIndex
+      (std::map<std::string, std::map<SubRunID, POTSummary>> const& sampled);
+
+    /// Adds a dataset to the index.
+    /// @throw std::invalid_argument if a dataset with that name is present
+    void addDataset(std::string const& name, POTRangeIndex index);
+
+    /// Returns the number of datasets.
+    std::size_t nDatasets() const { return fIndices.size(); }
+
+    /// Returns the names of the datasets, in the order they were added.
+    std::vector<std::string> const& datasetNames() const { return fNames; }
+
+    /// Returns whether the specified dataset is present.
+    bool hasDataset(std::string const& name) const
+      { return fByName.count(name) > 0; }
+
+    /// Returns the index of the dataset, `nullptr` if not present.
+    POTRangeIndex const* findDataset(std::string const& name) const;
+
+    /// Returns the index of the dataset.
+    /// @throw std::out_of_range if the dataset is not present
+    POTRangeIndex const& dataset(std::string const& name) const;
+
+    /// Returns the summary of a subrun of the dataset (`nullptr` if absent).
+    POTSummary const* find
+      (std::string const& dataset, POTRangeIndex::Key_t const& key) const;
+
+    /// Returns the summary of a subrun of the dataset (`nullptr` if absent).
+    template <typename SubRunID>
+    POTSummary const* find
+      (std::string const& dataset, SubRunID const& id) const
+      { return find(dataset, POTRangeIndex::makeKey(id)); }
+
+  private:
+
+    std::vector<std::string> fNames; ///< Names of the datasets.
+    std::vector<POTRangeIndex> fIndices; ///< Index of each dataset.
+
+    /// Position of each dataset in `fNames` and `fIndices`.
+    std::unordered_map<std::string, std::size_t> fByName;
+
+  }; // class SampledPOTIndex
+
+} // namespace sumdata
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename SubRunID>
+sumdata::POTRangeIndex::POTRangeIndex
+  (std::map<SubRunID, POTSummary> const& summaries)
+{
+  fKeys.reserve(summaries.size());
+  fSummaries.reserve(summaries.size());
+  for (auto const& [ id, summary ]: summaries) {
+    fKeys.push_back(makeKey(id));
+    fSummaries.push_back(summary);
+  }
+  buildPrefix();
+} // sumdata::POTRangeIndex::POTRangeIndex(map)
+
+
+//------------------------------------------------------------------------------
+template <typename SubRunID>
+sumdata::SampledPOTIndex::SampledPOTIndex
+  (std::map<std::string, std::map<SubRunID, POTSummary>> const& sampled)
+{
+  fNames.reserve(sampled.size());
+  fIndices.reserve(sampled.size());
+  for (auto const& [ name, summaries ]: sampled)
+    addDataset(name, POTRangeIndex{ summaries });
+} // sumdata::SampledPOTIndex::SampledPOTIndex()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SUMMARYDATA_POTRANGEINDEX_H
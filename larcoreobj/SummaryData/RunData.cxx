@@ -15,12 +15,14 @@ namespace sumdata {
   //---------------------------------------------------------
   RunData::RunData()
   : fDetName("nodetectorname")
+  , fDetNameHandle(fDetName)
   {
   }
 
   //---------------------------------------------------------
   RunData::RunData(std::string const& detectorName)
   : fDetName(detectorName)
+  , fDetNameHandle(fDetName)
   {
   }
 
@@ -30,7 +32,7 @@ namespace sumdata {
     // Each run is required to have the same detector name.
     // This might be a problem for Monte Carlo jobs which tend to use the same
     // run number for everything.
-    if (other.DetName() != DetName()) {
+    if (other.detNameHandle() != detNameHandle()) {
       throw std::runtime_error("The same run sees different detector setups: '"
         + DetName() + "' and '" + other.DetName()
         );
@@ -8,6 +8,8 @@
 #ifndef LARCOREOBJ_SUMMARYDATA_RUNDATA_H
 #define LARCOREOBJ_SUMMARYDATA_RUNDATA_H
 
+#include "larcoreobj/SummaryData/InternedString.h"
+
 #include <string>
 
 namespace sumdata {
@@ -20,6 +22,8 @@ namespace sumdata {
 
     /// What to do when multiple `RunData` objects are found for the same run.
     ///
+    /// The detector names are compared via their interned handles.
+    ///
     /// @throws std::runtime_error if `other` has a different `DetName()`
     void aggregate(RunData const& other);
 
@@ -27,6 +31,12 @@ namespace sumdata {
 
     std::string  fDetName; ///< Detector name.
 
+    /// Interned detector name (transient; set on read by a ROOT I/O rule).
+    InternedString fDetNameHandle; //!
+
+    /// Returns the interned detector name, also if the handle is not set.
+    InternedString detNameHandle() const;
+
   public:
     explicit           RunData(std::string const& detectorName);
     std::string const& DetName() const;
@@ -38,5 +48,8 @@ namespace sumdata {
 
 inline std::string const& sumdata::RunData::DetName() const { return fDetName; }
 
+inline sumdata::InternedString sumdata::RunData::detNameHandle() const
+  { return fDetNameHandle? fDetNameHandle: InternedString{ fDetName }; }
+
 
 #endif // LARCOREOBJ_SUMMARYDATA_RUNDATA_H
@@ -0,0 +1,180 @@
+/**
+ * @file   PhysicalQuantities_benchmark.cc
+ * @brief  Compares quantities with units against plain values.
+ * @see    larcoreobj/SimpleTypesAndConstants/PhysicalQuantities.h
+ *
+ * Usage: `PhysicalQuantities_benchmark [NValues [NRepetitions]]`
+ *
+ * The same loops (accumulation of lengths in mixed units, and projection of
+ * lengths on a direction given in degrees) are run with plain `double` values
+ * and explicit conversion constants, and with `util::units` quantities.
+ * The two versions are run alternately `NRepetitions` times, each round
+ * starting with a different one, and the best time of each is used for the
+ * printed throughput and for their ratio, so that neither is favoured by
+ * running first or by the machine warming up. The loops are also built with
+ * the same alignment, since the placement of otherwise identical loops across
+ * a fetch boundary can change their speed by tens of percent.
+ * The program fails only if the two versions give different results, which
+ * would mean that the conversions were not folded into the same constants.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalQuantities.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <utility> // std::pair
+#include <algorithm> // std::min()
+#include <limits> // std::numeric_limits<>
+#include <cmath> // std::cos()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+/// Throughput (values per second) and result of a computation.
+struct Measurement {
+  double rate = 0.0; ///< Values per second, from the fastest run.
+  double result = 0.0; ///< Sum of the results of all the runs.
+};
+
+
+/**
+ * @brief Runs `raw` and `typed` alternately `nReps` times each.
+ * @return the measurements of `raw` and of `typed`
+ *
+ * Each round runs both computations, swapping which goes first at each round,
+ * and only the fastest run of each computation is kept.
+ */
+template <typename Raw, typename Typed>
+std::pair<Measurement, Measurement> compare
+  (std::size_t nValues, unsigned int nReps, Raw raw, Typed typed)
+{
+  using clock_t = std::chrono::steady_clock;
+  using seconds_t = std::chrono::duration<double>;
+
+  double rawResult = raw(), typedResult = typed(); // warm up
+  double bestRaw = std::numeric_limits<double>::max();
+  double bestTyped = std::numeric_limits<double>::max();
+  auto const time = [](auto compute, double& result, double& best) {
+    auto const start = clock_t::now();
+    result += compute();
+    best = std::min(best, seconds_t(clock_t::now() - start).count());
+  };
+  for (unsigned int i = 0; i < nReps; ++i) {
+    if (i % 2U == 0U) {
+      time(raw, rawResult, bestRaw);
+      time(typed, typedResult, bestTyped);
+    }
+    else {
+      time(typed, typedResult, bestTyped);
+      time(raw, rawResult, bestRaw);
+    }
+  } // for
+
+  return {
+    { nValues / bestRaw, rawResult }, { nValues / bestTyped, typedResult }
+    };
+} // compare()
+
+
+//------------------------------------------------------------------------------
+// The kernels are kept out of line, so that the raw and the typed versions are
+// compiled in the same context and their generated code can be compared.
+
+/// Sum of lengths in meters, returned in centimeters.
+[[gnu::noinline]] double sumRaw(std::vector<double> const& meters) {
+  double total = 0.0; // cm
+  for (double v: meters) total += v * util::kMeterToCentimeter;
+  return total;
+} // sumRaw()
+
+[[gnu::noinline]] util::units::centimeter sumTyped
+  (std::vector<util::units::meter> const& meters)
+{
+  using namespace util::units::literals;
+  util::units::centimeter total = 0_cm;
+  for (util::units::meter v: meters) total += v;
+  return total;
+} // sumTyped()
+
+
+/// Sum of projections of lengths in meters on a direction at `angle` degrees.
+[[gnu::noinline]] double projectRaw
+  (std::vector<double> const& meters, double angle)
+{
+  double const c = std::cos(util::DegreesToRadians(angle));
+  double total = 0.0; // cm
+  for (double v: meters) total += v * util::kMeterToCentimeter * c;
+  return total;
+} // projectRaw()
+
+[[gnu::noinline]] util::units::centimeter projectTyped
+  (std::vector<util::units::meter> const& meters, util::units::degree angle)
+{
+  using namespace util::units::literals;
+  double const c = util::units::cos(angle);
+  util::units::centimeter total = 0_cm;
+  for (util::units::meter v: meters) total += util::units::centimeter(v) * c;
+  return total;
+} // projectTyped()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nValues = (argc > 1)? std::stoul(argv[1]): 1000000U;
+  unsigned int const nReps = (argc > 2)? std::stoul(argv[2]): 20U;
+
+  std::vector<double> rawMeters(nValues);
+  std::mt19937 engine { 12345U };
+  std::uniform_real_distribution<double> dist { 0.0, 10.0 };
+  for (double& v: rawMeters) v = dist(engine);
+
+  std::vector<util::units::meter> meters;
+  meters.reserve(nValues);
+  for (double v: rawMeters) meters.emplace_back(v);
+
+  double const rawAngle = 35.7; // degrees
+  util::units::degree const angle { rawAngle };
+
+  int nErrors = 0;
+  auto const report = [&nErrors]
+    (std::string const& name, std::pair<Measurement, Measurement> const& m)
+  {
+    Measurement const& raw = m.first;
+    Measurement const& typed = m.second;
+    std::cout << std::setw(12) << std::left << name << std::right
+      << " raw: " << std::setw(10) << std::setprecision(4) << raw.rate
+      << " values/s, quantities: " << std::setw(10) << typed.rate
+      << " values/s (x" << std::setprecision(3) << (typed.rate / raw.rate)
+      << ")" << std::endl;
+    if (raw.result != typed.result) {
+      std::cerr << "  ERROR: results differ: " << std::setprecision(17)
+        << raw.result << " vs. " << typed.result << std::endl;
+      ++nErrors;
+    }
+  };
+
+  // access through volatile pointers, to keep the compiler from calling each
+  // kernel just once for all the repetitions
+  std::vector<double> const* volatile rawData = &rawMeters;
+  std::vector<util::units::meter> const* volatile data = &meters;
+
+  report("sum", compare(nValues, nReps,
+    [&](){ return sumRaw(*rawData); },
+    [&](){ return sumTyped(*data).value(); }
+    ));
+
+  report("projection", compare(nValues, nReps,
+    [&](){ return projectRaw(*rawData, rawAngle); },
+    [&](){ return projectTyped(*data, angle).value(); }
+    ));
+
+  return nErrors;
+} // main()
@@ -0,0 +1,129 @@
+/**
+ * @file   PhysicalQuantities_test.cc
+ * @brief  Test of `larcoreobj/SimpleTypesAndConstants/PhysicalQuantities.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/PhysicalQuantities.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( PhysicalQuantities_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalQuantities.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <type_traits>
+#include <utility> // std::declval()
+#include <cmath> // std::cos()
+
+
+//------------------------------------------------------------------------------
+// compile-time checks
+namespace {
+
+  template <typename A, typename B, typename = void>
+  struct is_addable: std::false_type {};
+
+  template <typename A, typename B>
+  struct is_addable
+    <A, B, std::void_t<decltype(std::declval<A>() + std::declval<B>())>>
+    : std::true_type
+  {};
+
+  using namespace util::units;
+
+  // no overhead in size
+  static_assert(sizeof(centimeter) == sizeof(double));
+  static_assert(sizeof(centimeter_as<float>) == sizeof(float));
+  static_assert(std::is_trivially_copyable_v<meter>);
+
+  // conversions among units of the same dimension only
+  static_assert(std::is_convertible_v<meter, centimeter>);
+  static_assert(std::is_convertible_v<degree, radian>);
+  static_assert(!std::is_convertible_v<meter, megaelectronvolt>);
+  static_assert(!std::is_convertible_v<degree, centimeter>);
+  static_assert(!std::is_convertible_v<double, centimeter>);
+  static_assert(!std::is_convertible_v<centimeter, double>);
+  static_assert(is_addable<meter, centimeter>());
+  static_assert(!is_addable<meter, electronvolt>());
+  static_assert(!is_addable<meter, double>());
+
+  // conversions are constant expressions
+  using namespace util::units::literals;
+  static_assert(centimeter(2_m).value() == 2.0 * util::kMeterToCentimeter);
+  static_assert(meter(3_km).value() == 3.0 * util::kKilometerToMeter);
+  static_assert((1_GeV).in<Megaelectronvolt>().value() == 1000.0);
+  static_assert(1_m + 50_cm == 150_cm);
+  static_assert(1_m > 99_cm);
+  static_assert(radian(180_deg).value() == util::pi());
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Length_testcase) {
+
+  using namespace util::units;
+  using namespace util::units::literals;
+
+  centimeter const l1 = 2.5_m;
+  BOOST_CHECK_EQUAL(l1.value(), 250.0);
+
+  meter l2 { 1.0 };
+  l2 += 30_cm;
+  BOOST_CHECK_CLOSE(l2.value(), 1.3, 1e-12);
+  l2 -= 0.001_km;
+  BOOST_CHECK_CLOSE(l2.value(), 0.3, 1e-12);
+  l2 *= 2.0;
+  BOOST_CHECK_CLOSE(l2.value(), 0.6, 1e-12);
+
+  auto const sum = 1_km + 1_m; // unit of the left operand
+  static_assert(std::is_same_v<std::decay_t<decltype(sum)>, kilometer>);
+  BOOST_CHECK_CLOSE(sum.value(), 1.001, 1e-12);
+
+  BOOST_CHECK_CLOSE(20_cm / 1_m, 0.2, 1e-12); // ratio is a plain number
+  BOOST_CHECK_EQUAL((3_m / 2.0).value(), 1.5);
+  BOOST_CHECK_EQUAL((-(2.0 * 3_m)).value(), -6.0);
+
+  centimeter_as<float> const lf = 1.5_m;
+  BOOST_CHECK_EQUAL(lf.value(), 150.0f);
+
+} // BOOST_AUTO_TEST_CASE(Length_testcase)
+
+
+BOOST_AUTO_TEST_CASE(Energy_testcase) {
+
+  using namespace util::units;
+  using namespace util::units::literals;
+
+  megaelectronvolt const E = 1.2_GeV + 350_MeV;
+  BOOST_CHECK_CLOSE(E.value(), 1550.0, 1e-12);
+  BOOST_CHECK_CLOSE
+    (electronvolt(E).value(), 1550.0 * util::kMeVToeV, 1e-12);
+  BOOST_CHECK_CLOSE(gigaelectronvolt(23.6_eV).value(), 23.6e-9, 1e-12);
+  BOOST_CHECK(10_MeV < 0.1_GeV);
+
+} // BOOST_AUTO_TEST_CASE(Energy_testcase)
+
+
+BOOST_AUTO_TEST_CASE(Angle_testcase) {
+
+  using namespace util::units;
+  using namespace util::units::literals;
+
+  radian const a = 60_deg;
+  BOOST_CHECK_CLOSE(a.value(), util::DegreesToRadians(60.0), 1e-12);
+  BOOST_CHECK_CLOSE(degree(a).value(), 60.0, 1e-12);
+  BOOST_CHECK_CLOSE(cos(60_deg), 0.5, 1e-12);
+  BOOST_CHECK_CLOSE(sin(30_deg), 0.5, 1e-12);
+  BOOST_CHECK_CLOSE(tan(45_deg), 1.0, 1e-12);
+  BOOST_CHECK_EQUAL(cos(0.5_rad), std::cos(0.5));
+
+  std::ostringstream sstr;
+  sstr << 60_deg;
+  BOOST_CHECK_EQUAL(sstr.str(), "60 deg");
+
+} // BOOST_AUTO_TEST_CASE(Angle_testcase)
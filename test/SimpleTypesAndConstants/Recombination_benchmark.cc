@@ -0,0 +1,91 @@
+/**
+ * @file   Recombination_benchmark.cc
+ * @brief  Throughput of exact and tabulated modified box recombination.
+ * @see    larcoreobj/SimpleTypesAndConstants/TabulatedRecombination.h
+ *
+ * Usage: `Recombination_benchmark [NValues [NRepetitions]]`
+ *
+ * The program converts `NValues` values of dE/dx into dQ/dx with the exact
+ * `util::ModBoxRecombination` and with `util::TabulatedModBoxRecombination`
+ * (for a few error bounds), and prints the throughput of each.
+ * It fails only if the tabulated results exceed their error bound.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/TabulatedRecombination.h"
+#include "larcoreobj/SimpleTypesAndConstants/Recombination.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <algorithm> // std::max()
+#include <cmath> // std::abs()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+/// Runs `convert` `nReps` times and returns the conversions per second.
+template <typename Convert>
+double throughput(std::size_t nValues, unsigned int nReps, Convert convert) {
+  using clock_t = std::chrono::steady_clock;
+  auto const start = clock_t::now();
+  for (unsigned int i = 0; i < nReps; ++i) convert();
+  std::chrono::duration<double> const elapsed = clock_t::now() - start;
+  return nValues * double(nReps) / elapsed.count();
+} // throughput()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nValues = (argc > 1)? std::stoul(argv[1]): 1000000U;
+  unsigned int const nReps = (argc > 2)? std::stoul(argv[2]): 10U;
+
+  util::ModBoxRecombination const model { 0.5, 1.39 }; // kV/cm, g/cm^3
+
+  // dE/dx distribution: mostly MIP-like, with a long tail
+  std::vector<double> dEdx(nValues);
+  std::mt19937 engine { 12345U };
+  std::lognormal_distribution<double> dist { std::log(2.1), 0.4 };
+  for (double& v: dEdx) v = std::min(std::max(dist(engine), 1.0), 60.0);
+
+  std::vector<double> exact(nValues), tabulated(nValues);
+
+  double const exactRate = throughput(nValues, nReps, [&](){
+      util::dQdxFromdEdx(model, dEdx.data(), exact.data(), nValues);
+    });
+  std::cout << "Modified box, exact:       " << std::setw(12)
+    << std::setprecision(4) << exactRate << " values/s" << std::endl;
+
+  int nErrors = 0;
+  for (double const maxRelError: { 1e-3, 1e-5, 1e-7 }) {
+
+    util::TabulatedModBoxRecombination const table
+      { model, 1.0, 60.0, maxRelError };
+
+    double const tableRate = throughput(nValues, nReps, [&](){
+        util::dQdxFromdEdx(table, dEdx.data(), tabulated.data(), nValues);
+      });
+
+    double maxError = 0.0;
+    for (std::size_t i = 0; i < nValues; ++i) {
+      maxError = std::max
+        (maxError, std::abs((tabulated[i] - exact[i]) / exact[i]));
+    }
+
+    std::cout << "Modified box, tabulated:   " << std::setw(12)
+      << std::setprecision(4) << tableRate << " values/s"
+      << " (x" << std::setprecision(3) << (tableRate / exactRate) << ")"
+      << " with " << table.nIntervals() << " intervals,"
+      << " relative error " << maxError << " (bound: " << maxRelError << ")"
+      << std::endl;
+
+    if (maxError > maxRelError) ++nErrors;
+  } // for
+
+  return nErrors;
+} // main()
@@ -0,0 +1,229 @@
+/**
+ * @file   Recombination_test.cc
+ * @brief  Test of `larcoreobj/SimpleTypesAndConstants/Recombination.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/Recombination.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( Recombination_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/Recombination.h"
+#include "larcoreobj/SimpleTypesAndConstants/TabulatedRecombination.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <stdexcept> // std::domain_error, std::length_error
+#include <algorithm> // std::max()
+#include <limits> // std::numeric_limits<>
+#include <cmath> // std::log(), std::exp(), std::abs(), std::isnan()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+// test configuration: MicroBooNE-like field and argon density
+constexpr double EField = 0.273; // kV/cm
+constexpr double Density = 1.383; // g/cm^3
+constexpr double Wion = 1.0 / util::kMeVToElectrons; // MeV
+
+
+/// Returns `n` dE/dx values [MeV/cm] spanning the range of interest.
+template <typename T>
+std::vector<T> makeDEdx(std::size_t n) {
+  std::vector<T> values(n);
+  for (std::size_t i = 0; i < n; ++i)
+    values[i] = T(0.5) + T(49.5) * T(i) / T(n - 1);
+  return values;
+} // makeDEdx()
+
+
+//------------------------------------------------------------------------------
+// reference formulae, as written in calorimetry and simulation code
+double BirksDQdx(double dEdx) {
+  double const k = util::kRecombk / (Density * EField);
+  return dEdx * util::kRecombA / (1.0 + k * dEdx) / Wion;
+} // BirksDQdx()
+
+double BirksDEdx(double dQdx) {
+  return dQdx
+    / (util::kRecombA / Wion - util::kRecombk * dQdx / (Density * EField));
+} // BirksDEdx()
+
+double ModBoxDQdx(double dEdx) {
+  double const Xi = util::kModBoxB * dEdx / (Density * EField);
+  return dEdx * std::log(util::kModBoxA + Xi) / Xi / Wion;
+} // ModBoxDQdx()
+
+double ModBoxDEdx(double dQdx) {
+  double const Beta = util::kModBoxB / (Density * EField);
+  return (std::exp(Beta * Wion * dQdx) - util::kModBoxA) / Beta;
+} // ModBoxDEdx()
+
+
+//------------------------------------------------------------------------------
+template <typename T, typename Model, typename RefDQdx, typename RefDEdx>
+void testModel(
+  Model const& model, RefDQdx refDQdx, RefDEdx refDEdx,
+  double tolerance /* percent */
+) {
+  std::size_t const N = 1001;
+  std::vector<T> const dEdx = makeDEdx<T>(N);
+
+  std::vector<T> const dQdx = util::dQdxFromdEdx(model, dEdx);
+  BOOST_CHECK_EQUAL(dQdx.size(), N);
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_CHECK_CLOSE(double(dQdx[i]), refDQdx(double(dEdx[i])), tolerance);
+    BOOST_CHECK_EQUAL(dQdx[i], model.dQdx(dEdx[i])); // batch == scalar
+  }
+
+  std::vector<T> const backDEdx = util::dEdxFromdQdx(model, dQdx);
+  BOOST_CHECK_EQUAL(backDEdx.size(), N);
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_CHECK_CLOSE(double(backDEdx[i]), refDEdx(double(dQdx[i])), tolerance);
+    BOOST_CHECK_CLOSE(double(backDEdx[i]), double(dEdx[i]), tolerance);
+    BOOST_CHECK_EQUAL(backDEdx[i], model.dEdx(dQdx[i])); // batch == scalar
+  }
+
+  std::vector<T> R(N);
+  util::recombinationFactors(model, dEdx.data(), R.data(), N);
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_CHECK_CLOSE(
+      double(R[i]), refDQdx(double(dEdx[i])) * Wion / double(dEdx[i]),
+      tolerance
+      );
+  }
+
+  // in-place conversion
+  std::vector<T> values = dEdx;
+  util::dQdxFromdEdx(model, values.data(), values.data(), values.size());
+  for (std::size_t i = 0; i < N; ++i) BOOST_CHECK_EQUAL(values[i], dQdx[i]);
+
+} // testModel()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Birks_testcase) {
+
+  util::BirksRecombination const model { EField, Density };
+  BOOST_CHECK_EQUAL(model.A(), util::kRecombA);
+
+  testModel<double>(model, BirksDQdx, BirksDEdx, 1e-9);
+  testModel<float>(model, BirksDQdx, BirksDEdx, 1e-3);
+
+} // BOOST_AUTO_TEST_CASE(Birks_testcase)
+
+
+BOOST_AUTO_TEST_CASE(ModBox_testcase) {
+
+  util::ModBoxRecombination const model { EField, Density };
+  BOOST_CHECK_EQUAL(model.A(), util::kModBoxA);
+
+  testModel<double>(model, ModBoxDQdx, ModBoxDEdx, 1e-9);
+  testModel<float>(model, ModBoxDQdx, ModBoxDEdx, 1e-3);
+
+} // BOOST_AUTO_TEST_CASE(ModBox_testcase)
+
+
+BOOST_AUTO_TEST_CASE(TabulatedModBox_testcase) {
+
+  util::ModBoxRecombination const model { EField, Density };
+
+  for (double const maxRelError: { 1e-3, 1e-5, 1e-7 }) {
+
+    util::TabulatedModBoxRecombination const table
+      { model, 0.5, 50.0, maxRelError };
+    BOOST_TEST_MESSAGE("Relative error bound " << maxRelError << ": "
+      << table.nIntervals() << " intervals, measured error "
+      << table.measuredRelError()
+      );
+    BOOST_CHECK_LE(table.measuredRelError(), maxRelError);
+
+    // check on a sampling finer than and unaligned with the table
+    std::size_t const N = 7 * table.nIntervals() + 3;
+    std::vector<double> const dEdx = makeDEdx<double>(N);
+    std::vector<double> const dQdx = util::dQdxFromdEdx(table, dEdx);
+    double maxError = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+      double const exact = model.dQdx(dEdx[i]);
+      maxError = std::max(maxError, std::abs((dQdx[i] - exact) / exact));
+    }
+    BOOST_CHECK_LE(maxError, maxRelError);
+
+    // out of range values are computed exactly
+    BOOST_CHECK_EQUAL(table.dQdx(0.25), model.dQdx(0.25));
+    BOOST_CHECK_EQUAL(table.dQdx(100.0), model.dQdx(100.0));
+
+    // NaN is not tabulated either
+    BOOST_CHECK(std::isnan
+      (table.dQdx(std::numeric_limits<double>::quiet_NaN())));
+    BOOST_CHECK(std::isnan
+      (table.dQdx(std::numeric_limits<float>::quiet_NaN())));
+
+  } // for
+
+  // the range must stay away from the point with no collected charge
+  BOOST_CHECK_THROW(
+    (util::TabulatedModBoxRecombination{ model, 0.01, 50.0 }),
+    std::domain_error
+    );
+  BOOST_CHECK_THROW(
+    (util::TabulatedModBoxRecombination{ model, 50.0, 0.5 }),
+    std::domain_error
+    );
+
+} // BOOST_AUTO_TEST_CASE(TabulatedModBox_testcase)
+
+
+BOOST_AUTO_TEST_CASE(IonizationElectrons_testcase) {
+
+  util::ModBoxRecombination const model { EField, Density };
+  constexpr double Lifetime = 3.0; // ms
+  constexpr double MinDEdx = 1.0; // MeV/cm
+
+  std::size_t const N = 1001;
+  std::vector<double> const dEdx = makeDEdx<double>(N);
+  std::vector<double> energy(N), driftTime(N);
+  for (std::size_t i = 0; i < N; ++i) {
+    energy[i] = 1e-4 * (1.0 + (i % 7)); // GeV
+    driftTime[i] = 2.0 * double(i) / double(N - 1); // ms
+  }
+
+  std::vector<double> const electrons = util::ionizationElectrons
+    (model, Lifetime, MinDEdx, energy, dEdx, driftTime);
+  BOOST_CHECK_EQUAL(electrons.size(), N);
+  for (std::size_t i = 0; i < N; ++i) {
+    double const R = model.recombination(std::max(dEdx[i], MinDEdx));
+    double const expected = energy[i] * util::kGeVToElectrons * R
+      * std::exp(-driftTime[i] / Lifetime);
+    BOOST_CHECK_CLOSE(electrons[i], expected, 1e-9);
+  } // for
+
+  // single precision results from double precision deposits
+  std::vector<float> const electronsF = util::ionizationElectrons<float>
+    (model, Lifetime, MinDEdx, energy, dEdx, driftTime);
+  for (std::size_t i = 0; i < N; ++i)
+    BOOST_CHECK_CLOSE(double(electronsF[i]), electrons[i], 1e-4);
+
+  // infinite lifetime: no attenuation
+  std::vector<double> noAttenuation(N);
+  util::ionizationElectrons(
+    model, std::numeric_limits<double>::infinity(), MinDEdx, N,
+    energy.data(), dEdx.data(), driftTime.data(), noAttenuation.data()
+    );
+  for (std::size_t i = 0; i < N; ++i) {
+    double const R = model.recombination(std::max(dEdx[i], MinDEdx));
+    BOOST_CHECK_CLOSE
+      (noAttenuation[i], energy[i] * util::kGeVToElectrons * R, 1e-9);
+  }
+
+  std::vector<double> const shortVector(N - 1);
+  BOOST_CHECK_THROW(
+    util::ionizationElectrons
+      (model, Lifetime, MinDEdx, energy, shortVector, driftTime),
+    std::length_error
+    );
+
+} // BOOST_AUTO_TEST_CASE(IonizationElectrons_testcase)
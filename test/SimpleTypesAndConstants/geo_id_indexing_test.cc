@@ -0,0 +1,243 @@
+/**
+ * @file   geo_id_indexing_test.cc
+ * @brief  Test of `larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_id_indexing_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_indexing.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_id_indexing.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::is_sorted()
+#include <vector>
+#include <stdexcept> // std::out_of_range
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PackedID_testcase) {
+
+  static_assert(geo::packID(geo::TPCID{ 1U, 2U }) == 0x0001'0002'0000'0000ULL);
+  static_assert(geo::packID(geo::TPCID{}) == geo::InvalidPackedIDkey);
+
+  geo::WireID const wire { 1U, 0U, 2U, 8U };
+  BOOST_CHECK_EQUAL(geo::packID(wire), 0x0001'0000'0002'0008ULL);
+  BOOST_CHECK_EQUAL(geo::unpackID<geo::WireID>(geo::packID(wire)), wire);
+  BOOST_CHECK(!geo::unpackID<geo::WireID>(geo::InvalidPackedIDkey).isValid);
+
+  readout::ROPID const rop { 1U, 3U, 2U };
+  BOOST_CHECK_EQUAL(geo::unpackID<readout::ROPID>(geo::packID(rop)), rop);
+
+  // packed keys sort like the IDs
+  std::vector<geo::WireID> const wires {
+    geo::WireID{ 0U, 0U, 0U, 9U }, geo::WireID{ 0U, 0U, 1U, 0U },
+    geo::WireID{ 0U, 1U, 0U, 0U }, geo::WireID{ 1U, 0U, 0U, 0U },
+    geo::WireID{ 1U, 0U, 0U, 65534U }
+    };
+  BOOST_CHECK(std::is_sorted(wires.begin(), wires.end()));
+  std::vector<geo::PackedIDkey_t> keys;
+  for (geo::WireID const& wire: wires) keys.push_back(geo::packID(wire));
+  BOOST_CHECK(std::is_sorted(keys.begin(), keys.end()));
+
+  BOOST_CHECK_THROW
+    (geo::packID(geo::WireID{ 0U, 0U, 0U, 65535U }), std::out_of_range);
+
+} // BOOST_AUTO_TEST_CASE(PackedID_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IDlayout_testcase) {
+
+  constexpr geo::IDlayout<4U> layout {{ 2U, 4U, 3U, 5000U }};
+  static_assert(layout.size() == 120000U);
+  static_assert(layout.size<geo::TPCID>() == 8U);
+  static_assert(layout.index(geo::PlaneID{ 1U, 3U, 2U }) == 23U);
+
+  BOOST_CHECK_EQUAL(layout.extent(3U), 5000U);
+
+  geo::WireID const wire { 1U, 0U, 2U, 8U };
+  BOOST_CHECK(layout.contains(wire));
+  BOOST_CHECK_EQUAL
+    (layout.index(wire), ((1U * 4U + 0U) * 3U + 2U) * 5000U + 8U);
+  BOOST_CHECK_EQUAL(layout.makeID<geo::WireID>(layout.index(wire)), wire);
+
+  BOOST_CHECK(!layout.contains(geo::WireID{ 2U, 0U, 0U, 0U }));
+  BOOST_CHECK(!layout.contains(geo::WireID{ 0U, 0U, 0U, 5000U }));
+  BOOST_CHECK(!layout.contains(geo::WireID{}));
+
+  // dense indices follow the ID order
+  std::size_t expected = 0U;
+  for (unsigned int c = 0U; c < 2U; ++c) {
+    for (unsigned int t = 0U; t < 4U; ++t) {
+      for (unsigned int p = 0U; p < 3U; ++p) {
+        geo::PlaneID const plane { c, t, p };
+        BOOST_CHECK_EQUAL(layout.index(plane), expected);
+        BOOST_CHECK_EQUAL(layout.makeID<geo::PlaneID>(expected), plane);
+        ++expected;
+      } // for planes
+    } // for TPCs
+  } // for cryostats
+
+  // readout IDs
+  geo::IDlayout<3U> const ropLayout {{ 1U, 2U, 3U }};
+  BOOST_CHECK_EQUAL(ropLayout.index(readout::ROPID{ 0U, 1U, 1U }), 4U);
+
+  static_assert(layout.upperLayout<2U>().size() == 8U);
+  static_assert(layout.upperLayout<2U>().extent(1U) == 4U);
+
+} // BOOST_AUTO_TEST_CASE(IDlayout_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IDcontainer_testcase) {
+
+  readout::ROPlayout const layout {{ 2U, 4U, 3U }};
+
+  readout::ROPDataContainer<float> baselines { layout, 2048.0f };
+  BOOST_CHECK_EQUAL(baselines.size(), 24U);
+  BOOST_CHECK(!baselines.empty());
+
+  readout::ROPID const rop { 1U, 2U, 1U };
+  BOOST_CHECK(baselines.hasElement(rop));
+  BOOST_CHECK_EQUAL(baselines[rop], 2048.0f);
+  baselines[rop] = 400.0f;
+  BOOST_CHECK_EQUAL(baselines.at(rop), 400.0f);
+  BOOST_CHECK_EQUAL(baselines.indexOf(rop), (1U * 4U + 2U) * 3U + 1U);
+  BOOST_CHECK_EQUAL(baselines.elementID(baselines.indexOf(rop)), rop);
+  BOOST_CHECK_EQUAL(baselines.data()[baselines.indexOf(rop)], 400.0f);
+
+  BOOST_CHECK(!baselines.hasElement(readout::ROPID{ 0U, 4U, 0U }));
+  BOOST_CHECK_THROW
+    (baselines.at(readout::ROPID{ 0U, 4U, 0U }), std::out_of_range);
+  BOOST_CHECK_THROW(baselines.at(readout::ROPID{}), std::out_of_range);
+
+  // elements are in ID order
+  std::size_t index = 0U;
+  for (float const baseline: baselines) {
+    readout::ROPID const id = baselines.elementID(index++);
+    BOOST_CHECK_EQUAL(baseline, (id == rop)? 400.0f: 2048.0f);
+  }
+  BOOST_CHECK_EQUAL(index, baselines.size());
+
+  baselines.fill(0.0f);
+  BOOST_CHECK_EQUAL(baselines[rop], 0.0f);
+
+  // a TPC set container from the readout plane layout
+  readout::TPCsetDataContainer<int> const TPCsetData { layout, 1 };
+  BOOST_CHECK_EQUAL(TPCsetData.size(), 8U);
+  BOOST_CHECK_EQUAL(TPCsetData.at(readout::TPCsetID{ 1U, 3U }), 1);
+
+  // packed keys of readout IDs
+  BOOST_CHECK_EQUAL
+    (readout::unpackID<readout::ROPID>(readout::packID(rop)), rop);
+
+} // BOOST_AUTO_TEST_CASE(IDcontainer_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(StaticIDcontainer_testcase) {
+
+  using Layout_t = geo::StaticIDlayout<2U, 4U, 3U, 5000U>;
+  static_assert(Layout_t::NLevels == 4U);
+  static_assert(Layout_t::size() == 120000U);
+  static_assert(Layout_t::size<geo::PlaneID>() == 24U);
+  static_assert(Layout_t::extent(2U) == 3U);
+  static_assert(Layout_t::index(geo::PlaneID{ 1U, 3U, 2U }) == 23U);
+  static_assert(Layout_t::contains(geo::PlaneID{ 1U, 3U, 2U }));
+  static_assert(!Layout_t::contains(geo::PlaneID{ 1U, 4U, 0U }));
+  static_assert(Layout_t::layout().extent(3U) == 5000U);
+  BOOST_CHECK_EQUAL(Layout_t::makeID<geo::TPCID>(5U), (geo::TPCID{ 1U, 1U }));
+
+  using Container_t = geo::StaticIDcontainer<geo::PlaneID, float, Layout_t>;
+  static_assert(Container_t::size() == 24U);
+  static_assert(sizeof(Container_t) == 24U * sizeof(float));
+
+  Container_t gains { 1.0f };
+  geo::PlaneID const plane { 1U, 2U, 0U };
+  BOOST_CHECK(gains.hasElement(plane));
+  BOOST_CHECK_EQUAL(gains[plane], 1.0f);
+  gains[plane] = 0.5f;
+  BOOST_CHECK_EQUAL(gains.at(plane), 0.5f);
+  BOOST_CHECK_EQUAL(gains.indexOf(plane), (1U * 4U + 2U) * 3U + 0U);
+  BOOST_CHECK_EQUAL(gains.elementID(gains.indexOf(plane)), plane);
+
+  BOOST_CHECK(!gains.hasElement(geo::PlaneID{ 0U, 0U, 3U }));
+  BOOST_CHECK_THROW(gains.at(geo::PlaneID{ 0U, 0U, 3U }), std::out_of_range);
+  BOOST_CHECK_THROW(gains.at(geo::PlaneID{}), std::out_of_range);
+
+  // elements are in ID order, and match the ones of the dynamic container
+  geo::IDcontainer<geo::PlaneID, float> dynamicGains
+    { Layout_t::layout(), 1.0f };
+  dynamicGains[plane] = 0.5f;
+  BOOST_CHECK_EQUAL_COLLECTIONS(gains.begin(), gains.end(),
+    dynamicGains.begin(), dynamicGains.end());
+
+  // value-initialized elements
+  geo::StaticIDcontainer<readout::ROPID, int, geo::StaticIDlayout<1U, 2U, 3U>>
+    counts;
+  BOOST_CHECK_EQUAL(counts.size(), 6U);
+  for (int const count: counts) BOOST_CHECK_EQUAL(count, 0);
+  counts[readout::ROPID{ 0U, 1U, 2U }] = 4;
+  BOOST_CHECK_EQUAL(counts.data()[5U], 4);
+  counts.fill(2);
+  BOOST_CHECK_EQUAL(counts.at(readout::ROPID{ 0U, 1U, 2U }), 2);
+
+} // BOOST_AUTO_TEST_CASE(StaticIDcontainer_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PackedIDcsr_testcase) {
+
+  geo::PackedIDcsr<geo::PlaneID> const empty;
+  BOOST_CHECK_EQUAL(empty.nRows(), 0U);
+  BOOST_CHECK_EQUAL(empty.nValues(), 0U);
+  BOOST_CHECK_THROW(empty.at(0U), std::out_of_range);
+
+  // unsorted, with a duplicate and an invalid ID
+  geo::PackedIDcsr<geo::PlaneID> const table { 4U, {
+    { 2U, geo::PlaneID{ 0U, 1U, 2U } },
+    { 0U, geo::PlaneID{ 0U, 0U, 1U } },
+    { 2U, geo::PlaneID{ 0U, 1U, 0U } },
+    { 0U, geo::PlaneID{ 0U, 0U, 1U } },
+    { 3U, geo::PlaneID{} }
+    } };
+  BOOST_CHECK_EQUAL(table.nRows(), 4U);
+  BOOST_CHECK_EQUAL(table.nValues(), 3U);
+  BOOST_CHECK_EQUAL(table.offsets().size(), 5U);
+
+  BOOST_CHECK_EQUAL(table[0U].size(), 1U);
+  BOOST_CHECK_EQUAL(table[0U].front(), (geo::PlaneID{ 0U, 0U, 1U }));
+  BOOST_CHECK(table[1U].empty());
+  BOOST_CHECK(table[3U].empty());
+
+  std::vector<geo::PlaneID> planes;
+  for (geo::PlaneID const& plane: table[2U]) planes.push_back(plane);
+  BOOST_CHECK_EQUAL(planes.size(), 2U);
+  BOOST_CHECK(std::is_sorted(planes.begin(), planes.end()));
+  BOOST_CHECK(table[2U].contains(geo::PlaneID{ 0U, 1U, 2U }));
+  BOOST_CHECK(!table[2U].contains(geo::PlaneID{ 0U, 1U, 1U }));
+  BOOST_CHECK(!table[2U].contains(geo::PlaneID{}));
+  BOOST_CHECK_THROW(table.at(4U), std::out_of_range);
+
+  // a view on the same data
+  geo::PackedIDcsrView<geo::PlaneID> const view
+    { table.offsets().data(), table.nRows(), table.keys().data() };
+  BOOST_CHECK_EQUAL(view.nValues(), 3U);
+  BOOST_CHECK_EQUAL(view[2U][1U], (geo::PlaneID{ 0U, 1U, 2U }));
+
+  std::vector<geo::PackedIDcsr<geo::PlaneID>::Entry_t> const badRow
+    { { 1U, geo::PlaneID{ 0U, 0U, 0U } } };
+  BOOST_CHECK_THROW
+    ((geo::PackedIDcsr<geo::PlaneID>{ 1U, badRow }), std::out_of_range);
+
+} // BOOST_AUTO_TEST_CASE(PackedIDcsr_testcase)
+
+
+//------------------------------------------------------------------------------
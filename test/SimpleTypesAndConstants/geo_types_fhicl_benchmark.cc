@@ -0,0 +1,316 @@
+/**
+ * @file   geo_types_fhicl_benchmark.cc
+ * @brief  Time and memory spent reading ID parameters from FHiCL.
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_types_fhicl.h
+ *         larcoreobj/SimpleTypesAndConstants/readout_types_fhicl.h
+ *
+ * Usage: `geo_types_fhicl_benchmark [MaxIDs]`
+ *
+ * The program writes FHiCL configurations with 10, 1000 and 100000 IDs (up to
+ * `MaxIDs`, by default 1000) in each of the supported forms:
+ * * `IDparameter`: a sequence of tables, each with one ID parameter;
+ * * `OptionalID`: a sequence of tables, each with one optional ID parameter;
+ * * `IDsequence`: a single sequence of IDs;
+ * * `OptionalIDsequence`: a single optional sequence of IDs;
+ * both for `geo::WireID` and `readout::ROPID`.
+ * For each configuration it prints the time spent parsing the text into a
+ * parameter set, validating the parameter set and converting the parameters
+ * into IDs, and the increase of peak resident memory caused by all that.
+ * Each configuration is run in its own child process, so that its memory
+ * peak is not hidden by the ones of the configurations run before it.
+ * It fails only if the IDs read differ from the ones written.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_types_fhicl.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types_fhicl.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// support libraries
+#include "fhiclcpp/types/Table.h"
+#include "fhiclcpp/types/Sequence.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "fhiclcpp/make_ParameterSet.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdlib> // std::_Exit()
+#include <cstdio> // std::perror()
+#include <cstddef> // std::size_t
+
+// POSIX
+#include <sys/resource.h> // getrusage()
+#include <sys/wait.h> // waitpid()
+#include <unistd.h> // fork()
+
+
+//------------------------------------------------------------------------------
+/// Generation of the `i`-th test ID and of its FHiCL representation.
+template <typename ID>
+struct TestID;
+
+template <>
+struct TestID<geo::WireID> {
+  static geo::WireID make(std::size_t i)
+    {
+      return {
+        0U, unsigned(i / 15000U), unsigned(i / 5000U % 3U),
+        unsigned(i % 5000U)
+        };
+    }
+  static void write(std::ostream& out, geo::WireID const& id)
+    {
+      out << "{ C:" << id.Cryostat << " T:" << id.TPC << " P:" << id.Plane
+        << " W:" << id.Wire << " }";
+    }
+}; // TestID<geo::WireID>
+
+template <>
+struct TestID<readout::ROPID> {
+  static readout::ROPID make(std::size_t i)
+    {
+      return {
+        unsigned(i / 4000U), readout::TPCsetID::TPCsetID_t(i / 4U % 1000U),
+        unsigned(i % 4U)
+        };
+    }
+  static void write(std::ostream& out, readout::ROPID const& id)
+    {
+      out << "{ C:" << id.Cryostat << " S:" << id.TPCset << " R:" << id.ROP
+        << " }";
+    }
+}; // TestID<readout::ROPID>
+
+
+//------------------------------------------------------------------------------
+// --- BEGIN -- Configurations -------------------------------------------------
+template <typename ID>
+struct IDentry {
+  geo::fhicl::IDparameter<ID> Value { fhicl::Name("Value") };
+};
+
+template <typename ID>
+struct OptionalIDentry {
+  geo::fhicl::OptionalID<ID> Value { fhicl::Name("Value") };
+};
+
+template <typename ID>
+struct IDparameterConfig {
+  fhicl::Sequence<fhicl::Table<IDentry<ID>>> IDs { fhicl::Name("IDs") };
+};
+
+template <typename ID>
+struct OptionalIDConfig {
+  fhicl::Sequence<fhicl::Table<OptionalIDentry<ID>>> IDs
+    { fhicl::Name("IDs") };
+};
+
+template <typename ID>
+struct IDsequenceConfig {
+  geo::fhicl::IDsequence<ID> IDs { fhicl::Name("IDs") };
+};
+
+template <typename ID>
+struct OptionalIDsequenceConfig {
+  geo::fhicl::OptionalIDsequence<ID> IDs { fhicl::Name("IDs") };
+};
+
+// --- END -- Configurations ---------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+/// Returns the FHiCL configuration of `IDs`, each in a table if `inTables`.
+template <typename ID>
+std::string writeConfig(std::vector<ID> const& IDs, bool inTables) {
+  std::ostringstream out;
+  out << "IDs: [";
+  for (std::size_t i = 0; i < IDs.size(); ++i) {
+    if (i > 0) out << ",";
+    out << "\n  ";
+    if (inTables) out << "{ Value: ";
+    TestID<ID>::write(out, IDs[i]);
+    if (inTables) out << " }";
+  } // for
+  out << "\n]\n";
+  return out.str();
+} // writeConfig()
+
+
+//------------------------------------------------------------------------------
+/// Returns the peak resident memory of this process so far, in kB.
+long peakMemory() {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+} // peakMemory()
+
+
+/**
+ * @brief Runs `test` in a child process.
+ * @return the value returned by `test`, or `1` if the child failed
+ *
+ * The peak memory of a freshly forked process starts from its current
+ * resident memory, rather than from the peak reached by its parent.
+ */
+template <typename Test>
+unsigned int runInChild(Test test) {
+  std::cout.flush(); // or the child may print our buffer again
+  pid_t const pid = fork();
+  if (pid < 0) {
+    std::perror("fork");
+    return 1U;
+  }
+  if (pid == 0) {
+    unsigned int const nErrors = test();
+    std::cout.flush();
+    std::_Exit(static_cast<int>(nErrors)); // skip the parent's cleanup
+  }
+  int status = 0;
+  if (waitpid(pid, &status, 0) != pid) {
+    std::perror("waitpid");
+    return 1U;
+  }
+  return (WIFEXITED(status) && (WEXITSTATUS(status) == 0))? 0U: 1U;
+} // runInChild()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Reads `configStr` with `convert`, prints the cost, checks the result.
+ * @return the number of errors (`0` or `1`)
+ *
+ * The memory is reported as the increase of the peak during the reading.
+ */
+template <typename Config, typename ID, typename Convert>
+unsigned int measure(
+  std::string const& formName,
+  std::string const& configStr, std::vector<ID> const& expected,
+  Convert convert
+) {
+  using clock_t = std::chrono::steady_clock;
+  using ms_t = std::chrono::duration<double, std::milli>;
+
+  long const baseMemory = peakMemory();
+  auto const start = clock_t::now();
+
+  fhicl::ParameterSet pset;
+  fhicl::make_ParameterSet(configStr, pset);
+  auto const parsed = clock_t::now();
+
+  fhicl::Table<Config> config { fhicl::Name("config") };
+  config.validate_ParameterSet(pset);
+  auto const validated = clock_t::now();
+
+  std::vector<ID> const IDs = convert(config());
+  auto const converted = clock_t::now();
+
+  bool const success = (IDs == expected);
+  std::cout << std::setw(20) << std::left << formName << std::right
+    << std::setw(8) << expected.size() << " IDs:"
+    << std::fixed << std::setprecision(3)
+    << "  parse " << std::setw(10) << ms_t(parsed - start).count() << " ms"
+    << "  validate " << std::setw(10) << ms_t(validated - parsed).count()
+      << " ms"
+    << "  convert " << std::setw(10) << ms_t(converted - validated).count()
+      << " ms"
+    << "  peak memory +" << std::setw(8) << (peakMemory() - baseMemory)
+      << " kB"
+    << (success? "": "  [ERROR: wrong IDs]")
+    << std::defaultfloat << std::endl;
+  return success? 0U: 1U;
+} // measure()
+
+
+/// Runs `measure()` in a child process (see `runInChild()`).
+template <typename Config, typename ID, typename Convert>
+unsigned int benchmark(
+  std::string const& formName,
+  std::string const& configStr, std::vector<ID> const& expected,
+  Convert convert
+) {
+  return runInChild([&]()
+    { return measure<Config>(formName, configStr, expected, convert); }
+    );
+} // benchmark()
+
+
+//------------------------------------------------------------------------------
+/// Runs the benchmark of all the forms of configuration of `nIDs` IDs.
+template <typename ID>
+unsigned int benchmarkAllForms(std::size_t nIDs) {
+
+  std::vector<ID> expected;
+  expected.reserve(nIDs);
+  for (std::size_t i = 0; i < nIDs; ++i)
+    expected.push_back(TestID<ID>::make(i));
+
+  std::string const tableConfig = writeConfig(expected, true);
+  std::string const sequenceConfig = writeConfig(expected, false);
+
+  unsigned int nErrors = 0U;
+
+  nErrors += benchmark<IDparameterConfig<ID>>
+    ("IDparameter", tableConfig, expected,
+     [](IDparameterConfig<ID> const& config)
+      {
+        std::vector<ID> IDs;
+        for (auto const& entry: config.IDs())
+          IDs.push_back(geo::fhicl::readID(entry.Value));
+        return IDs;
+      }
+    );
+
+  nErrors += benchmark<OptionalIDConfig<ID>>
+    ("OptionalID", tableConfig, expected,
+     [](OptionalIDConfig<ID> const& config)
+      {
+        std::vector<ID> IDs;
+        for (auto const& entry: config.IDs()) {
+          if (auto const id = geo::fhicl::readOptionalID(entry.Value))
+            IDs.push_back(*id);
+        }
+        return IDs;
+      }
+    );
+
+  nErrors += benchmark<IDsequenceConfig<ID>>
+    ("IDsequence", sequenceConfig, expected,
+     [](IDsequenceConfig<ID> const& config)
+      { return geo::fhicl::readIDsequence(config.IDs); }
+    );
+
+  nErrors += benchmark<OptionalIDsequenceConfig<ID>>
+    ("OptionalIDsequence", sequenceConfig, expected,
+     [](OptionalIDsequenceConfig<ID> const& config)
+      { return geo::fhicl::readOptionalIDsequence(config.IDs, {}); }
+    );
+
+  return nErrors;
+} // benchmarkAllForms()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const maxIDs = (argc > 1)? std::stoul(argv[1]): 1000U;
+
+  unsigned int nErrors = 0U;
+  for (std::size_t const nIDs: { 10U, 1000U, 100000U }) {
+    if (nIDs > maxIDs) break;
+
+    std::cout << "=== geo::WireID ===" << std::endl;
+    nErrors += benchmarkAllForms<geo::WireID>(nIDs);
+
+    std::cout << "=== readout::ROPID ===" << std::endl;
+    nErrors += benchmarkAllForms<readout::ROPID>(nIDs);
+
+  } // for
+
+  return nErrors;
+} // main()
@@ -23,8 +23,11 @@
 // C/C++ standard libraries
 #include <iostream>
 #include <string>
+#include <algorithm> // std::is_sorted(), std::count(), std::min()
 #include <array>
+#include <stdexcept> // std::invalid_argument, std::out_of_range
 #include <type_traits> // std::is_same_v<>
+#include <limits> // std::numeric_limits<>
 
 
 //------------------------------------------------------------------------------
@@ -1408,6 +1411,349 @@ void test_WireUnifiedInterface() {
 // --- END -- Wire ID tests ----------------------------------------------------
 
 
+// --- BEGIN -- ID range tests -------------------------------------------------
+
+void test_WireIDrangeSequence_normal() {
+
+  using ID_t = geo::WireID;
+  struct Config {
+    geo::fhicl::WireIDrangeSequence Wires { fhicl::Name("Wires") };
+  };
+
+  std::string const configStr { R"(Wires: [
+    { C:0 T:1 P:2 W:[ 4001, 4100 ] },
+    { C:1 T:0 P:0 W:[ 7, 7 ] },
+    { isValid:false },
+    { C:0 T:1 P:2 W:[ 100, 4000 ] },
+    { C:0 T:1 P:2 W:[ 3000, 3500 ] },
+    { C:0 T:1 P:1 W:[ 0, 9 ] }
+    ]
+    )" };
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  auto const wires = geo::fhicl::readIDrangeSequence(validatedConfig.Wires);
+  static_assert(std::is_same_v
+    <decltype(wires), geo::fhicl::IDintervals<ID_t> const>);
+
+  // sorted, overlapping and adjacent intervals merged, invalid one ignored
+  BOOST_CHECK_EQUAL(wires.nIntervals(), 3U);
+  BOOST_CHECK_EQUAL(wires.nIDs(), 10U + 4001U + 1U);
+  if (wires.nIntervals() == 3U) {
+    auto const& intervals = wires.intervals();
+    BOOST_CHECK_EQUAL(intervals[0].first, (ID_t{ 0U, 1U, 1U, 0U }));
+    BOOST_CHECK_EQUAL(intervals[0].last, 9U);
+    BOOST_CHECK_EQUAL(intervals[1].first, (ID_t{ 0U, 1U, 2U, 100U }));
+    BOOST_CHECK_EQUAL(intervals[1].lastID(), (ID_t{ 0U, 1U, 2U, 4100U }));
+    BOOST_CHECK_EQUAL(intervals[2].first, (ID_t{ 1U, 0U, 0U, 7U }));
+    BOOST_CHECK_EQUAL(intervals[2].size(), 1U);
+  }
+
+  BOOST_CHECK( wires.contains(ID_t{ 0U, 1U, 2U,  100U }));
+  BOOST_CHECK( wires.contains(ID_t{ 0U, 1U, 2U, 4000U }));
+  BOOST_CHECK( wires.contains(ID_t{ 0U, 1U, 2U, 4001U }));
+  BOOST_CHECK( wires.contains(ID_t{ 0U, 1U, 2U, 4100U }));
+  BOOST_CHECK(!wires.contains(ID_t{ 0U, 1U, 2U,   99U }));
+  BOOST_CHECK(!wires.contains(ID_t{ 0U, 1U, 2U, 4101U }));
+  BOOST_CHECK(!wires.contains(ID_t{ 0U, 1U, 0U,  500U }));
+  BOOST_CHECK( wires.contains(ID_t{ 0U, 1U, 1U,    9U }));
+  BOOST_CHECK(!wires.contains(ID_t{ 0U, 1U, 1U,   10U }));
+  BOOST_CHECK( wires.contains(ID_t{ 1U, 0U, 0U,    7U }));
+  BOOST_CHECK(!wires.contains(ID_t{ 1U, 0U, 0U,    8U }));
+
+  std::vector<ID_t> const ids = wires.IDs();
+  BOOST_CHECK_EQUAL(ids.size(), wires.nIDs());
+  BOOST_CHECK(std::is_sorted(ids.begin(), ids.end()));
+
+} // test_WireIDrangeSequence_normal()
+
+
+void test_WireIDrangeSequence_reversed() {
+
+  struct Config {
+    geo::fhicl::WireIDrangeSequence Wires { fhicl::Name("Wires") };
+  };
+
+  std::string const configStr { "Wires: [ { C:0 T:1 P:2 W:[ 10, 9 ] } ]" };
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  BOOST_CHECK_THROW(
+    geo::fhicl::readIDrangeSequence(validatedConfig.Wires),
+    std::invalid_argument
+    );
+
+} // test_WireIDrangeSequence_reversed()
+
+
+void test_IDintervals_largestIndex() {
+
+  using ID_t = geo::WireID;
+  using Intervals_t = geo::fhicl::IDintervals<ID_t>;
+  constexpr auto MaxIndex = std::numeric_limits<Intervals_t::Index_t>::max();
+
+  Intervals_t const wires {{
+    Intervals_t::Interval_t{ ID_t{ 0U, 0U, 0U, MaxIndex - 2U }, MaxIndex },
+    Intervals_t::Interval_t{ ID_t{ 0U, 0U, 0U, MaxIndex }, MaxIndex }
+    }};
+  BOOST_CHECK_EQUAL(wires.nIntervals(), 1U);
+  BOOST_CHECK_EQUAL(wires.nIDs(), 3U);
+  BOOST_CHECK(wires.contains(ID_t{ 0U, 0U, 0U, MaxIndex }));
+
+  std::vector<ID_t> const ids = wires.IDs();
+  BOOST_CHECK_EQUAL(ids.size(), 3U);
+  BOOST_CHECK_EQUAL(ids.back(), (ID_t{ 0U, 0U, 0U, MaxIndex }));
+
+  // the whole index range does not fit the index type
+  Intervals_t const all
+    {{ Intervals_t::Interval_t{ ID_t{ 0U, 0U, 0U, 0U }, MaxIndex } }};
+  BOOST_CHECK_EQUAL(all.nIDs(), std::size_t(MaxIndex) + 1U);
+
+} // test_IDintervals_largestIndex()
+
+
+void test_OptionalCryostatIDrangeSequence() {
+
+  using ID_t = geo::CryostatID;
+  struct Config {
+    geo::fhicl::OptionalCryostatIDrangeSequence Cryos
+      { fhicl::Name("Cryos") };
+  };
+
+  auto validatedConfig
+    = validateConfig<Config>("Cryos: [ { C:[ 0, 1 ] }, { C:[ 2, 2 ] } ]")();
+
+  auto const cryos = geo::fhicl::readParameter(validatedConfig.Cryos);
+  static_assert(std::is_same_v
+    <decltype(cryos), std::optional<geo::fhicl::IDintervals<ID_t>> const>);
+
+  BOOST_CHECK(cryos.has_value());
+  if (cryos) {
+    BOOST_CHECK_EQUAL(cryos->nIntervals(), 1U);
+    BOOST_CHECK(cryos->contains(ID_t{ 2U }));
+    BOOST_CHECK(!cryos->contains(ID_t{ 3U }));
+  }
+
+  auto omittedConfig = validateConfig<Config>("")();
+  BOOST_CHECK(!geo::fhicl::readParameter(omittedConfig.Cryos).has_value());
+
+} // test_OptionalCryostatIDrangeSequence()
+
+
+void test_PlaneIDrangeSequence() {
+
+  using ID_t = geo::PlaneID;
+  struct Config {
+    geo::fhicl::TPCIDrangeSequence TPCs { fhicl::Name("TPCs") };
+    geo::fhicl::OpDetIDrangeSequence OpDets { fhicl::Name("OpDets") };
+    geo::fhicl::PlaneIDrangeSequence Planes { fhicl::Name("Planes") };
+  };
+
+  std::string const configStr { R"(
+    TPCs:   [ { C:0 T:[ 0, 3 ] } ]
+    OpDets: [ { C:1 O:[ 0, 179 ] } ]
+    Planes: [ { C:0 T:1 P:[ 0, 2 ] } ]
+    )" };
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  BOOST_CHECK_EQUAL
+    (geo::fhicl::readIDrangeSequence(validatedConfig.TPCs).nIDs(), 4U);
+  BOOST_CHECK_EQUAL
+    (geo::fhicl::readIDrangeSequence(validatedConfig.OpDets).nIDs(), 180U);
+
+  auto const planes = geo::fhicl::readIDrangeSequence(validatedConfig.Planes);
+  BOOST_CHECK_EQUAL(planes.nIDs(), 3U);
+  BOOST_CHECK(planes.contains(ID_t{ 0U, 1U, 2U }));
+  BOOST_CHECK(!planes.contains(ID_t{ 0U, 0U, 2U }));
+
+} // test_PlaneIDrangeSequence()
+
+
+// --- END -- ID range tests ---------------------------------------------------
+
+
+// --- BEGIN -- Bulk ID sequence tests -----------------------------------------
+
+void test_WireIDsequence_bulk() {
+
+  using ID_t = geo::WireID;
+  struct Config
+    { geo::fhicl::WireIDsequence Wires { fhicl::Name("Wires") }; };
+
+  std::string const configStr { R"(Wires: [
+    { C:0 T:1 P:2 W:9 },
+    { C:0 T:0 P:1 W:4 },
+    { isValid:false },
+    { C:0 T:1 P:2 W:9 },
+    { C:0 T:1 P:0 W:0 }
+    ]
+    )" };
+  std::array<ID_t, 3U> const expectedIDs {{
+    ID_t{ 0U, 0U, 1U, 4U }, ID_t{ 0U, 1U, 0U, 0U }, ID_t{ 0U, 1U, 2U, 9U }
+    }};
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  auto const ids = geo::fhicl::readSortedIDsequence(validatedConfig.Wires);
+  static_assert(std::is_same_v<decltype(ids), std::vector<ID_t> const>);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (ids.begin(), ids.end(), expectedIDs.begin(), expectedIDs.end());
+
+  auto const keys = geo::fhicl::readPackedIDsequence(validatedConfig.Wires);
+  BOOST_CHECK_EQUAL(keys.size(), expectedIDs.size());
+  for (std::size_t i = 0; i < std::min(keys.size(), expectedIDs.size()); ++i)
+    BOOST_CHECK_EQUAL(geo::unpackID<ID_t>(keys[i]), expectedIDs[i]);
+
+  geo::IDlayout<4U> const layout {{ 1U, 2U, 3U, 10U }};
+  auto const bits
+    = geo::fhicl::readIDsequenceBits(validatedConfig.Wires, layout);
+  BOOST_CHECK_EQUAL(bits.size(), layout.size());
+  BOOST_CHECK_EQUAL(std::count(bits.begin(), bits.end(), true), 3);
+  for (ID_t const& id: expectedIDs) BOOST_CHECK(bits[layout.index(id)]);
+
+  geo::IDlayout<4U> const smallLayout {{ 1U, 2U, 3U, 5U }};
+  BOOST_CHECK_THROW(
+    geo::fhicl::readIDsequenceBits(validatedConfig.Wires, smallLayout),
+    std::out_of_range
+    );
+
+} // test_WireIDsequence_bulk()
+
+
+void test_OptionalPlaneIDsequence_bulk() {
+
+  using ID_t = geo::PlaneID;
+  struct Config {
+    geo::fhicl::OptionalPlaneIDsequence Planes { fhicl::Name("Planes") };
+  };
+
+  auto validatedConfig = validateConfig<Config>
+    ("Planes: [ { C:0 T:1 P:1 }, { C:0 T:0 P:2 }, { C:0 T:1 P:1 } ]")();
+
+  auto const ids
+    = geo::fhicl::readOptionalSortedIDsequence(validatedConfig.Planes);
+  BOOST_CHECK(ids.has_value());
+  if (ids) {
+    BOOST_CHECK_EQUAL(ids->size(), 2U);
+    BOOST_CHECK_EQUAL(ids->front(), (ID_t{ 0U, 0U, 2U }));
+  }
+
+  auto const keys
+    = geo::fhicl::readOptionalPackedIDsequence(validatedConfig.Planes);
+  BOOST_CHECK(keys.has_value());
+  if (keys) BOOST_CHECK_EQUAL(keys->size(), 2U);
+
+  geo::IDlayout<3U> const layout {{ 1U, 2U, 3U }};
+  auto const bits
+    = geo::fhicl::readOptionalIDsequenceBits(validatedConfig.Planes, layout);
+  BOOST_CHECK(bits.has_value());
+  if (bits) {
+    BOOST_CHECK_EQUAL(bits->size(), 6U);
+    BOOST_CHECK((*bits)[2U]);
+    BOOST_CHECK((*bits)[4U]);
+  }
+
+  auto omittedConfig = validateConfig<Config>("")();
+  BOOST_CHECK
+    (!geo::fhicl::readOptionalSortedIDsequence(omittedConfig.Planes));
+  BOOST_CHECK
+    (!geo::fhicl::readOptionalPackedIDsequence(omittedConfig.Planes));
+  BOOST_CHECK
+    (!geo::fhicl::readOptionalIDsequenceBits(omittedConfig.Planes, layout));
+
+} // test_OptionalPlaneIDsequence_bulk()
+
+
+// --- END -- Bulk ID sequence tests -------------------------------------------
+
+
+// --- BEGIN -- Validated ID tests ---------------------------------------------
+
+void test_ValidatedWireID() {
+
+  using ID_t = geo::WireID;
+  struct Config {
+    geo::fhicl::WireID Wire { fhicl::Name("Wire") };
+    geo::fhicl::OptionalWireID MaybeWire { fhicl::Name("MaybeWire") };
+    geo::fhicl::WireID BadWire { fhicl::Name("BadWire") };
+    geo::fhicl::WireID InvalidWire { fhicl::Name("InvalidWire") };
+  };
+
+  std::string const configStr { R"(
+    Wire: { C:0 T:1 P:2 W:9 }
+    BadWire: { C:0 T:2 P:2 W:9 }
+    InvalidWire: { isValid:false }
+    )" };
+
+  geo::IDlayout<4U> const layout {{ 1U, 2U, 3U, 10U }};
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  auto const wire = geo::fhicl::readValidatedID(validatedConfig.Wire, layout);
+  static_assert
+    (std::is_same_v<decltype(wire), geo::fhicl::IndexedID<ID_t> const>);
+  BOOST_CHECK_EQUAL(wire.id, (ID_t{ 0U, 1U, 2U, 9U }));
+  BOOST_CHECK_EQUAL(wire.index, layout.index(wire.id));
+
+  BOOST_CHECK
+    (!geo::fhicl::readOptionalValidatedID(validatedConfig.MaybeWire, layout));
+
+  BOOST_CHECK_THROW(
+    geo::fhicl::readValidatedID(validatedConfig.BadWire, layout),
+    std::out_of_range
+    );
+  BOOST_CHECK_THROW(
+    geo::fhicl::readValidatedID(validatedConfig.InvalidWire, layout),
+    std::out_of_range
+    );
+
+} // test_ValidatedWireID()
+
+
+void test_ValidatedPlaneIDsequence() {
+
+  using ID_t = geo::PlaneID;
+  struct Config {
+    geo::fhicl::PlaneIDsequence Planes { fhicl::Name("Planes") };
+    geo::fhicl::OptionalPlaneIDsequence MaybePlanes
+      { fhicl::Name("MaybePlanes") };
+  };
+
+  std::string const configStr { R"(
+    Planes: [ { C:0 T:1 P:1 }, { C:0 T:0 P:2 }, { C:0 T:1 P:1 } ]
+    MaybePlanes: [ { C:0 T:1 P:1 }, { C:0 T:0 P:3 } ]
+    )" };
+
+  geo::IDlayout<3U> const layout {{ 1U, 2U, 3U }};
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  auto const planes
+    = geo::fhicl::readValidatedIDsequence(validatedConfig.Planes, layout);
+  static_assert
+    (std::is_same_v<decltype(planes), geo::fhicl::IndexedIDs<ID_t> const>);
+  BOOST_CHECK_EQUAL(planes.size(), 3U);
+  BOOST_CHECK_EQUAL(planes.indices.size(), 3U);
+  if (planes.size() == 3U) {
+    BOOST_CHECK_EQUAL(planes[0].id, (ID_t{ 0U, 1U, 1U }));
+    BOOST_CHECK_EQUAL(planes[0].index, 4U);
+    BOOST_CHECK_EQUAL(planes[1].index, 2U);
+    BOOST_CHECK_EQUAL(planes[2].index, 4U);
+  }
+
+  BOOST_CHECK_THROW(
+    geo::fhicl::readOptionalValidatedIDsequence
+      (validatedConfig.MaybePlanes, layout),
+    std::out_of_range
+    );
+
+} // test_ValidatedPlaneIDsequence()
+
+
+// --- END -- Validated ID tests -----------------------------------------------
+
+
 
 // --- BEGIN -- Documentation tests --------------------------------------------
 void test_groupDocumentation_example1() {
@@ -1695,6 +2041,45 @@ BOOST_AUTO_TEST_CASE(WireID_testcase) {
 } // BOOST_AUTO_TEST_CASE(WireID_testcase)
 
 
+//------------------------------------------------------------------------------
+//
+// ID range test
+//
+BOOST_AUTO_TEST_CASE(IDrange_testcase) {
+
+  test_WireIDrangeSequence_normal();
+  test_WireIDrangeSequence_reversed();
+  test_IDintervals_largestIndex();
+  test_OptionalCryostatIDrangeSequence();
+  test_PlaneIDrangeSequence();
+
+} // BOOST_AUTO_TEST_CASE(IDrange_testcase)
+
+
+//------------------------------------------------------------------------------
+//
+// bulk ID sequence test
+//
+BOOST_AUTO_TEST_CASE(BulkIDsequence_testcase) {
+
+  test_WireIDsequence_bulk();
+  test_OptionalPlaneIDsequence_bulk();
+
+} // BOOST_AUTO_TEST_CASE(BulkIDsequence_testcase)
+
+
+//------------------------------------------------------------------------------
+//
+// validated ID test
+//
+BOOST_AUTO_TEST_CASE(ValidatedID_testcase) {
+
+  test_ValidatedWireID();
+  test_ValidatedPlaneIDsequence();
+
+} // BOOST_AUTO_TEST_CASE(ValidatedID_testcase)
+
+
 //------------------------------------------------------------------------------
 //
 // documentation test
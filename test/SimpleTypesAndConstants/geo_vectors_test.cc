@@ -0,0 +1,177 @@
+/**
+ * @file   geo_vectors_test.cc
+ * @brief  Test of `geo::FrameTransformation` (`geo_vectors.h`).
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_vectors.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_vectors_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK_SMALL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cmath> // std::cos(), std::sin()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+using PlanePoint_t = geo::PointIn_t<geo::PlaneLocalCoordinateSystemTag>;
+using PlaneVector_t = geo::VectorIn_t<geo::PlaneLocalCoordinateSystemTag>;
+using TPCPoint_t = geo::PointIn_t<geo::TPCLocalCoordinateSystemTag>;
+using TPCVector_t = geo::VectorIn_t<geo::TPCLocalCoordinateSystemTag>;
+
+using PlaneToTPC_t = geo::FrameTransformation
+  <geo::PlaneLocalCoordinateSystemTag, geo::TPCLocalCoordinateSystemTag>;
+using TPCToWorld_t = geo::FrameTransformation
+  <geo::TPCLocalCoordinateSystemTag, geo::GlobalCoords>;
+using PlaneToWorld_t = geo::FrameTransformation
+  <geo::PlaneLocalCoordinateSystemTag, geo::GlobalCoords>;
+
+constexpr double Tolerance = 1e-9; // absolute, on coordinates up to ~300
+
+
+/// Returns a rotation by `angle` around the z axis.
+geo::Rotation_t rotationZ(double angle) {
+  double const c = std::cos(angle), s = std::sin(angle);
+  return geo::Rotation_t{ c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0 };
+} // rotationZ()
+
+
+/// Returns a rotation by `angle` around the x axis.
+geo::Rotation_t rotationX(double angle) {
+  double const c = std::cos(angle), s = std::sin(angle);
+  return geo::Rotation_t{ 1.0, 0.0, 0.0, 0.0, c, -s, 0.0, s, c };
+} // rotationX()
+
+
+/// Checks that the two points (or vectors) have the same coordinates.
+template <typename A, typename B>
+void checkSame(A const& a, B const& b) {
+  BOOST_CHECK_SMALL(a.X() - b.X(), Tolerance);
+  BOOST_CHECK_SMALL(a.Y() - b.Y(), Tolerance);
+  BOOST_CHECK_SMALL(a.Z() - b.Z(), Tolerance);
+} // checkSame()
+
+
+std::vector<PlanePoint_t> const Points {
+  { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 2.0, -1.0 },
+  { -3.5, 4.0, 12.25 }, { 100.0, -50.0, 0.5 }
+  };
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FrameTransformationSingle_testcase) {
+
+  // identity
+  PlaneToTPC_t const identity;
+  checkSame
+    (identity(PlanePoint_t{ 1.0, 2.0, 3.0 }), TPCPoint_t{ 1.0, 2.0, 3.0 });
+
+  // pure translation: vectors are not affected
+  PlaneToTPC_t const shift { TPCVector_t{ 10.0, -5.0, 2.0 } };
+  checkSame
+    (shift(PlanePoint_t{ 1.0, 2.0, 3.0 }), TPCPoint_t{ 11.0, -3.0, 5.0 });
+  checkSame
+    (shift(PlaneVector_t{ 1.0, 2.0, 3.0 }), TPCVector_t{ 1.0, 2.0, 3.0 });
+
+  // rotation by 90 degrees around z, then translation
+  PlaneToTPC_t const toTPC
+    { rotationZ(std::acos(0.0)), TPCVector_t{ 10.0, 0.0, 0.0 } };
+  checkSame(toTPC(PlanePoint_t{ 1.0, 2.0, 3.0 }), TPCPoint_t{ 8.0, 1.0, 3.0 });
+  checkSame
+    (toTPC(PlaneVector_t{ 1.0, 2.0, 3.0 }), TPCVector_t{ -2.0, 1.0, 3.0 });
+  checkSame(toTPC.translation(), TPCVector_t{ 10.0, 0.0, 0.0 });
+
+} // BOOST_AUTO_TEST_CASE(FrameTransformationSingle_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FrameTransformationInverse_testcase) {
+
+  PlaneToTPC_t const toTPC
+    { rotationX(0.3) * rotationZ(1.2), TPCVector_t{ 10.0, -4.0, 2.5 } };
+  PlaneToTPC_t::Inverse_t const toPlane = toTPC.inverse();
+
+  for (PlanePoint_t const& p: Points) {
+    checkSame(toPlane(toTPC(p)), p);
+    PlaneVector_t const v { p.X(), p.Y(), p.Z() };
+    checkSame(toPlane(toTPC(v)), v);
+  }
+
+  // the inverse of the inverse is the original transformation
+  PlaneToTPC_t const again = toPlane.inverse();
+  for (PlanePoint_t const& p: Points) checkSame(again(p), toTPC(p));
+
+} // BOOST_AUTO_TEST_CASE(FrameTransformationInverse_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FrameTransformationComposition_testcase) {
+
+  PlaneToTPC_t const planeToTPC
+    { rotationZ(0.7), TPCVector_t{ 0.0, 3.0, -1.0 } };
+  TPCToWorld_t const tpcToWorld
+    { rotationX(-0.4), geo::Vector_t{ 100.0, 20.0, 5.0 } };
+
+  PlaneToWorld_t const planeToWorld = tpcToWorld * planeToTPC;
+
+  for (PlanePoint_t const& p: Points) {
+    checkSame(planeToWorld(p), tpcToWorld(planeToTPC(p)));
+    PlaneVector_t const v { p.X(), p.Y(), p.Z() };
+    checkSame(planeToWorld(v), tpcToWorld(planeToTPC(v)));
+  }
+
+  // composition with the inverse is the identity
+  auto const identity = planeToTPC.inverse() * planeToTPC;
+  for (PlanePoint_t const& p: Points) checkSame(identity(p), p);
+
+} // BOOST_AUTO_TEST_CASE(FrameTransformationComposition_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FrameTransformationBatch_testcase) {
+
+  PlaneToWorld_t const planeToWorld
+    { rotationX(0.25) * rotationZ(-2.0), geo::Vector_t{ -7.0, 1.5, 300.0 } };
+
+  // iterator interface
+  std::vector<geo::Point_t> worldPoints(Points.size());
+  auto const last = planeToWorld.transformPoints
+    (Points.begin(), Points.end(), worldPoints.begin());
+  BOOST_CHECK(last == worldPoints.end());
+  for (std::size_t i = 0; i < Points.size(); ++i)
+    checkSame(worldPoints[i], planeToWorld.transformPoint(Points[i]));
+
+  // collection interface
+  std::vector<geo::Point_t> const points
+    = planeToWorld.transformPoints(Points);
+  BOOST_CHECK_EQUAL(points.size(), Points.size());
+  for (std::size_t i = 0; i < Points.size(); ++i)
+    checkSame(points[i], worldPoints[i]);
+
+  // vectors are rotated but not translated
+  std::vector<PlaneVector_t> vectors;
+  for (PlanePoint_t const& p: Points)
+    vectors.emplace_back(p.X(), p.Y(), p.Z());
+  std::vector<geo::Vector_t> const worldVectors
+    = planeToWorld.transformVectors(vectors);
+  BOOST_CHECK_EQUAL(worldVectors.size(), vectors.size());
+  for (std::size_t i = 0; i < vectors.size(); ++i) {
+    checkSame(worldVectors[i], planeToWorld.transformVector(vectors[i]));
+    checkSame(
+      worldVectors[i] + planeToWorld.translation(),
+      planeToWorld.transformPoint(Points[i])
+      );
+  }
+
+  BOOST_CHECK
+    (planeToWorld.transformPoints(std::vector<PlanePoint_t>{}).empty());
+
+} // BOOST_AUTO_TEST_CASE(FrameTransformationBatch_testcase)
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,89 @@
+/**
+ * @file   geo_view_angles_test.cc
+ * @brief  Test of `larcoreobj/SimpleTypesAndConstants/geo_view_angles.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_view_angles.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_view_angles_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_view_angles.h"
+#include "larcoreobj/SimpleTypesAndConstants/angle_conversions.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <cmath> // std::cos(), std::sin()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchAngleConversion_testcase) {
+
+  std::vector<double> const degrees { -180.0, -60.0, 0.0, 35.7, 90.0, 360.0 };
+
+  std::vector<double> const radians = util::DegreesToRadians(degrees);
+  BOOST_CHECK_EQUAL(radians.size(), degrees.size());
+  for (std::size_t i = 0; i < degrees.size(); ++i) {
+    BOOST_CHECK_CLOSE
+      (radians[i] + 1.0, util::DegreesToRadians(degrees[i]) + 1.0, 1e-12);
+  }
+
+  std::vector<double> const back = util::RadiansToDegrees(radians);
+  for (std::size_t i = 0; i < degrees.size(); ++i)
+    BOOST_CHECK_CLOSE(back[i] + 1.0, degrees[i] + 1.0, 1e-12);
+
+  // in place, single precision
+  std::vector<float> angles { 30.0f, 45.0f, 60.0f };
+  util::DegreesToRadians(angles.data(), angles.data(), angles.size());
+  BOOST_CHECK_CLOSE(angles[1], util::pi<float>() / 4.0f, 1e-4);
+
+} // BOOST_AUTO_TEST_CASE(BatchAngleConversion_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ViewAngleTable_testcase) {
+
+  double const angleU = util::DegreesToRadians(+60.0);
+  double const angleV = util::DegreesToRadians(-60.0);
+
+  geo::ViewAngleTable angles { { geo::kU, angleU }, { geo::kV, angleV } };
+  BOOST_CHECK(angles.hasView(geo::kU));
+  BOOST_CHECK(angles.hasView(geo::kV));
+  BOOST_CHECK(!angles.hasView(geo::kW));
+  BOOST_CHECK(!angles.hasView(geo::kUnknown));
+  BOOST_CHECK_THROW(angles.project(geo::kW, 1.0, 1.0), std::out_of_range);
+  BOOST_CHECK_THROW(angles.setAngle(geo::k3D, 0.0), std::out_of_range);
+
+  angles.setAngle(geo::kW, 0.0);
+  BOOST_CHECK(angles.hasView(geo::kZ)); // same as kW
+  BOOST_CHECK_EQUAL(angles.angle(geo::kU), angleU);
+  BOOST_CHECK_EQUAL(angles.cosAngle(geo::kV), std::cos(angleV));
+  BOOST_CHECK_EQUAL(angles.sinAngle(geo::kV), std::sin(angleV));
+
+  std::size_t const N = 101;
+  std::vector<double> z(N), y(N);
+  for (std::size_t i = 0; i < N; ++i) {
+    z[i] = 0.3 * i;
+    y[i] = -116.0 + 2.3 * i;
+  }
+
+  for (geo::View_t const view: { geo::kU, geo::kV, geo::kW }) {
+    double const angle = angles.angle(view);
+    std::vector<double> const proj = angles.project(view, z, y);
+    BOOST_CHECK_EQUAL(proj.size(), N);
+    for (std::size_t i = 0; i < N; ++i) {
+      double const expected = z[i] * std::cos(angle) + y[i] * std::sin(angle);
+      BOOST_CHECK_EQUAL(angles.project(view, z[i], y[i]), proj[i]);
+      BOOST_CHECK_CLOSE(proj[i] + 1000.0, expected + 1000.0, 1e-12);
+    }
+  } // for views
+
+  std::vector<double> const shortVector(N - 1);
+  BOOST_CHECK_THROW(angles.project(geo::kU, z, shortVector), std::length_error);
+
+} // BOOST_AUTO_TEST_CASE(ViewAngleTable_testcase)
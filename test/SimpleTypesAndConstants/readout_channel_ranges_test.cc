@@ -0,0 +1,117 @@
+/**
+ * @file   readout_channel_ranges_test.cc
+ * @brief  Test of `larcoreobj/SimpleTypesAndConstants/readout_channel_ranges.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/readout_channel_ranges.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( readout_channel_ranges_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_channel_ranges.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <stdexcept> // std::invalid_argument
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelRangeSet_testcase) {
+
+  readout::ChannelRangeSet const empty;
+  BOOST_CHECK(empty.empty());
+  BOOST_CHECK_EQUAL(empty.nChannels(), 0U);
+  BOOST_CHECK(!empty.contains(0U));
+
+  // unsorted, overlapping, adjacent and invalid ranges
+  readout::ChannelRangeSet const channels {{
+    readout::ChannelRange{ 20U, 29U },
+    readout::ChannelRange{  0U,  4U },
+    readout::ChannelRange{ 25U, 34U },
+    readout::ChannelRange{  5U,  9U },
+    readout::ChannelRange{},
+    readout::ChannelRange{ 50U, 50U }
+    }};
+  BOOST_CHECK_EQUAL(channels.nRanges(), 3U);
+  BOOST_CHECK_EQUAL(channels.nChannels(), 26U);
+  BOOST_CHECK_EQUAL(channels.ranges()[0].first, 0U);
+  BOOST_CHECK_EQUAL(channels.ranges()[0].last, 9U);
+  BOOST_CHECK_EQUAL(channels.ranges()[1].first, 20U);
+  BOOST_CHECK_EQUAL(channels.ranges()[1].last, 34U);
+
+  for (raw::ChannelID_t channel = 0U; channel < 60U; ++channel) {
+    bool const expected = (channel < 10U)
+      || ((channel >= 20U) && (channel < 35U)) || (channel == 50U);
+    BOOST_TEST_CONTEXT("Channel " << channel) {
+      BOOST_CHECK_EQUAL(channels.contains(channel), expected);
+    }
+  } // for
+  BOOST_CHECK(!channels.contains(raw::InvalidChannelID));
+
+  BOOST_CHECK_THROW(
+    (readout::ChannelRangeSet{{ readout::ChannelRange{ 5U, 4U } }}),
+    std::invalid_argument
+    );
+
+} // BOOST_AUTO_TEST_CASE(ChannelRangeSet_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelRangeSetResolve_testcase) {
+
+  // a detector with 100 channels per readout plane, 3 planes per TPC set
+  auto firstChannel = [](readout::ROPID const& rop)
+    { return raw::ChannelID_t((rop.TPCset * 3U + rop.ROP) * 100U); };
+
+  std::vector<readout::ROPID> const ROPs {
+    readout::ROPID{ 0U, 1U, 0U }, readout::ROPID{},
+    readout::ROPID{ 0U, 0U, 2U }, readout::ROPID{ 0U, 1U, 1U }
+    };
+
+  unsigned int nCalls = 0U;
+  readout::ChannelRangeSet const channels = readout::ChannelRangeSet::resolve
+    (ROPs, [&nCalls, firstChannel](readout::ROPID const& rop)
+      {
+        ++nCalls;
+        raw::ChannelID_t const first = firstChannel(rop);
+        return readout::ChannelRange{ first, first + 99U };
+      }
+    );
+  BOOST_CHECK_EQUAL(nCalls, 3U); // invalid ID is skipped
+  BOOST_CHECK_EQUAL(channels.nRanges(), 1U); // 200-299, 300-399, 400-499
+  BOOST_CHECK_EQUAL(channels.nChannels(), 300U);
+  BOOST_CHECK(!channels.contains(199U));
+  BOOST_CHECK(channels.contains(200U));
+  BOOST_CHECK(channels.contains(499U));
+  BOOST_CHECK(!channels.contains(500U));
+
+  // TPC sets resolved into one range per readout plane
+  std::vector<readout::TPCsetID> const TPCsets
+    { readout::TPCsetID{ 0U, 2U }, readout::TPCsetID{ 0U, 0U } };
+  readout::ChannelRangeSet const setChannels = readout::ChannelRangeSet::resolve
+    (TPCsets, [firstChannel](readout::TPCsetID const& tpcset)
+      {
+        std::vector<readout::ChannelRange> ranges;
+        for (readout::ROPID::ROPID_t r = 0U; r < 3U; ++r) {
+          raw::ChannelID_t const first
+            = firstChannel(readout::ROPID{ tpcset, r });
+          ranges.push_back({ first, first + 99U });
+        }
+        return ranges;
+      }
+    );
+  BOOST_CHECK_EQUAL(setChannels.nRanges(), 2U);
+  BOOST_CHECK_EQUAL(setChannels.nChannels(), 600U);
+  BOOST_CHECK(setChannels.contains(0U));
+  BOOST_CHECK(!setChannels.contains(300U));
+  BOOST_CHECK(setChannels.contains(600U));
+  BOOST_CHECK(setChannels.contains(899U));
+
+} // BOOST_AUTO_TEST_CASE(ChannelRangeSetResolve_testcase)
+
+
+//------------------------------------------------------------------------------
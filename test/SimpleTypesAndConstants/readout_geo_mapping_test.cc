@@ -0,0 +1,154 @@
+/**
+ * @file   readout_geo_mapping_test.cc
+ * @brief  Test of `larcoreobj/SimpleTypesAndConstants/readout_geo_mapping.h`.
+ * @see    larcoreobj/SimpleTypesAndConstants/readout_geo_mapping.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( readout_geo_mapping_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/readout_geo_mapping.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <stdexcept> // std::out_of_range, std::invalid_argument
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ROPplaneMapping_testcase) {
+
+  // a cryostat with two TPCs sharing the readout of their induction planes:
+  // TPC set 0 has ROP 0 (induction, on both TPCs), ROP 1 and ROP 2
+  // (collection, one per TPC)
+  readout::ROPlayout const ropLayout {{ 1U, 1U, 3U }};
+  readout::PlaneLayout const planeLayout {{ 1U, 2U, 2U }};
+
+  std::vector<readout::ROPplaneMapping::Pair_t> const pairs {
+    { readout::ROPID{ 0U, 0U, 0U }, geo::PlaneID{ 0U, 1U, 0U } },
+    { readout::ROPID{ 0U, 0U, 0U }, geo::PlaneID{ 0U, 0U, 0U } },
+    { readout::ROPID{ 0U, 0U, 1U }, geo::PlaneID{ 0U, 0U, 1U } },
+    { readout::ROPID{ 0U, 0U, 2U }, geo::PlaneID{ 0U, 1U, 1U } }
+    };
+
+  readout::ROPplaneMapping const mapping { ropLayout, planeLayout, pairs };
+  BOOST_CHECK_EQUAL(mapping.nPairs(), 4U);
+
+  auto const inductionPlanes = mapping.planes(readout::ROPID{ 0U, 0U, 0U });
+  BOOST_CHECK_EQUAL(inductionPlanes.size(), 2U);
+  BOOST_CHECK_EQUAL(inductionPlanes[0U], (geo::PlaneID{ 0U, 0U, 0U }));
+  BOOST_CHECK_EQUAL(inductionPlanes[1U], (geo::PlaneID{ 0U, 1U, 0U }));
+
+  auto const collectionPlanes = mapping.planes(readout::ROPID{ 0U, 0U, 2U });
+  BOOST_CHECK_EQUAL(collectionPlanes.size(), 1U);
+  BOOST_CHECK_EQUAL(collectionPlanes.front(), (geo::PlaneID{ 0U, 1U, 1U }));
+
+  BOOST_CHECK_EQUAL
+    (mapping.ROP(geo::PlaneID{ 0U, 1U, 0U }), (readout::ROPID{ 0U, 0U, 0U }));
+  BOOST_CHECK_EQUAL
+    (mapping.ROP(geo::PlaneID{ 0U, 0U, 1U }), (readout::ROPID{ 0U, 0U, 1U }));
+  BOOST_CHECK_EQUAL(mapping.ROPs(geo::PlaneID{ 0U, 1U, 1U }).size(), 1U);
+
+  // IDs out of the layouts have no association
+  BOOST_CHECK(mapping.planes(readout::ROPID{ 0U, 1U, 0U }).empty());
+  BOOST_CHECK(mapping.planes(readout::ROPID{}).empty());
+  BOOST_CHECK(!mapping.ROP(geo::PlaneID{ 0U, 2U, 0U }).isValid);
+
+  // both directions agree
+  for (auto const& [ rop, plane ]: pairs) {
+    BOOST_CHECK(mapping.planes(rop).contains(plane));
+    BOOST_CHECK(mapping.ROPs(plane).contains(rop));
+  }
+
+  std::vector<readout::ROPplaneMapping::Pair_t> const badPairs
+    { { readout::ROPID{ 0U, 0U, 3U }, geo::PlaneID{ 0U, 0U, 0U } } };
+  BOOST_CHECK_THROW(
+    (readout::ROPplaneMapping{ ropLayout, planeLayout, badPairs }),
+    std::out_of_range
+    );
+
+  readout::ROPplaneMapping const empty;
+  BOOST_CHECK_EQUAL(empty.nPairs(), 0U);
+  BOOST_CHECK(empty.planes(readout::ROPID{ 0U, 0U, 0U }).empty());
+
+} // BOOST_AUTO_TEST_CASE(ROPplaneMapping_testcase)
+
+
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelWireMapping_testcase) {
+
+  // one TPC with two planes of 4 wires each; the first plane has wires 0 and 3
+  // on the same channel (wrapped), and wire 2 of the second plane is missing
+  readout::WireLayout const wireLayout {{ 1U, 1U, 2U, 4U }};
+  std::vector<readout::ChannelWireMapping::Pair_t> const pairs {
+    { 0U, geo::WireID{ 0U, 0U, 0U, 3U } },
+    { 0U, geo::WireID{ 0U, 0U, 0U, 0U } },
+    { 1U, geo::WireID{ 0U, 0U, 0U, 1U } },
+    { 2U, geo::WireID{ 0U, 0U, 0U, 2U } },
+    { 3U, geo::WireID{ 0U, 0U, 1U, 0U } },
+    { 4U, geo::WireID{ 0U, 0U, 1U, 1U } },
+    { 6U, geo::WireID{ 0U, 0U, 1U, 3U } }
+    };
+
+  readout::ChannelWireMapping const mapping { 7U, wireLayout, pairs };
+  BOOST_CHECK_EQUAL(mapping.nChannels(), 7U);
+
+  auto const wires = mapping.wires(0U);
+  BOOST_CHECK_EQUAL(wires.size(), 2U);
+  BOOST_CHECK_EQUAL(wires[0U], (geo::WireID{ 0U, 0U, 0U, 0U }));
+  BOOST_CHECK_EQUAL(wires[1U], (geo::WireID{ 0U, 0U, 0U, 3U }));
+  BOOST_CHECK(mapping.wires(5U).empty()); // no wire
+  BOOST_CHECK(mapping.wires(7U).empty()); // no channel
+  BOOST_CHECK(mapping.wires(raw::InvalidChannelID).empty());
+
+  for (auto const& [ channel, wire ]: pairs) {
+    BOOST_CHECK_EQUAL(mapping.channel(wire), channel);
+    BOOST_CHECK(mapping.wires(channel).contains(wire));
+  }
+  BOOST_CHECK_EQUAL
+    (mapping.channel(geo::WireID{ 0U, 0U, 1U, 2U }), raw::InvalidChannelID);
+  BOOST_CHECK_EQUAL
+    (mapping.channel(geo::WireID{ 0U, 0U, 1U, 4U }), raw::InvalidChannelID);
+  BOOST_CHECK_EQUAL(mapping.channel(geo::WireID{}), raw::InvalidChannelID);
+
+  // the view answers the same
+  readout::ChannelWireMappingView const view = mapping.view();
+  BOOST_CHECK_EQUAL(view.nChannels(), mapping.nChannels());
+  BOOST_CHECK_EQUAL(view.wires(0U).size(), 2U);
+  BOOST_CHECK_EQUAL(view.channel(geo::WireID{ 0U, 0U, 1U, 3U }), 6U);
+  BOOST_CHECK_EQUAL(view.channelTable(), mapping.channelTable().data());
+
+  std::vector<readout::ChannelWireMapping::Pair_t> const badChannel
+    { { 7U, geo::WireID{ 0U, 0U, 0U, 0U } } };
+  BOOST_CHECK_THROW(
+    (readout::ChannelWireMapping{ 7U, wireLayout, badChannel }),
+    std::out_of_range
+    );
+
+  std::vector<readout::ChannelWireMapping::Pair_t> const doubleWire {
+    { 0U, geo::WireID{ 0U, 0U, 0U, 0U } },
+    { 1U, geo::WireID{ 0U, 0U, 0U, 0U } }
+    };
+  BOOST_CHECK_THROW(
+    (readout::ChannelWireMapping{ 7U, wireLayout, doubleWire }),
+    std::invalid_argument
+    );
+
+  readout::ChannelWireMappingView const empty;
+  BOOST_CHECK_EQUAL(empty.nChannels(), 0U);
+  BOOST_CHECK(empty.wires(0U).empty());
+  BOOST_CHECK_EQUAL
+    (empty.channel(geo::WireID{ 0U, 0U, 0U, 0U }), raw::InvalidChannelID);
+
+} // BOOST_AUTO_TEST_CASE(ChannelWireMapping_testcase)
+
+
+//------------------------------------------------------------------------------
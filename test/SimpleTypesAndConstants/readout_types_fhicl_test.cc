@@ -938,6 +938,67 @@ void test_ROPUnifiedInterface() {
 } // test_ROPUnifiedInterface()
 
 
+void test_ROPchannelRanges() {
+
+  struct Config {
+
+    readout::fhicl::ROPIDsequence ROPs { fhicl::Name("ROPs") };
+
+    readout::fhicl::OptionalROPIDsequence MaybeROPs
+      { fhicl::Name("MaybeROPs") };
+
+    readout::fhicl::OptionalROPIDsequence NoROPs { fhicl::Name("NoROPs") };
+
+  }; // struct Config
+
+  std::string const configStr {
+    "ROPs: [ { C:0 S:1 R:1 }, { isValid:false }, { C:0 S:0 R:2 } ]"
+    "\nMaybeROPs: [ { C:0 S:1 R:0 } ]"
+    };
+
+  auto validatedConfig = validateConfig<Config>(configStr)();
+
+  // 100 channels per readout plane, 3 readout planes per TPC set
+  unsigned int nCalls = 0U;
+  auto resolver = [&nCalls](readout::ROPID const& rop)
+    {
+      ++nCalls;
+      raw::ChannelID_t const first = (rop.TPCset * 3U + rop.ROP) * 100U;
+      return readout::ChannelRange{ first, first + 99U };
+    };
+
+  auto const channels
+    = readout::fhicl::readChannelRanges(validatedConfig.ROPs, resolver);
+  static_assert
+    (std::is_same_v<decltype(channels), readout::ChannelRangeSet const>);
+  BOOST_CHECK_EQUAL(nCalls, 2U);
+  BOOST_CHECK_EQUAL(channels.nRanges(), 2U);
+  BOOST_CHECK_EQUAL(channels.nChannels(), 200U);
+  BOOST_CHECK(!channels.contains(199U));
+  BOOST_CHECK(channels.contains(200U));
+  BOOST_CHECK(!channels.contains(300U));
+  BOOST_CHECK(channels.contains(499U));
+
+  auto const maybeChannels = readout::fhicl::readOptionalChannelRanges
+    (validatedConfig.MaybeROPs, resolver);
+  static_assert(std::is_same_v<
+    decltype(maybeChannels), std::optional<readout::ChannelRangeSet> const
+    >);
+  BOOST_CHECK(maybeChannels.has_value());
+  if (maybeChannels) {
+    BOOST_CHECK_EQUAL(maybeChannels->nChannels(), 100U);
+    BOOST_CHECK(maybeChannels->contains(300U));
+  }
+
+  nCalls = 0U;
+  auto const noChannels = readout::fhicl::readOptionalChannelRanges
+    (validatedConfig.NoROPs, resolver);
+  BOOST_CHECK(!noChannels.has_value());
+  BOOST_CHECK_EQUAL(nCalls, 0U);
+
+} // test_ROPchannelRanges()
+
+
 // --- END -- Readout plane ID tests -------------------------------------------
 
 
@@ -1006,6 +1067,8 @@ BOOST_AUTO_TEST_CASE(ROPID_testcase) {
   test_OptionalROPIDsequence_omitted();
   test_ROPUnifiedInterface();
 
+  test_ROPchannelRanges();
+
 } // BOOST_AUTO_TEST_CASE(ROPID_testcase)
 
 
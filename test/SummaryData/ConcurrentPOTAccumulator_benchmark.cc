@@ -0,0 +1,109 @@
+/**
+ * @file   ConcurrentPOTAccumulator_benchmark.cc
+ * @brief  Contention of `sumdata::ConcurrentPOTAccumulator` versus a mutex.
+ * @see    larcoreobj/SummaryData/ConcurrentPOTAccumulator.h
+ *
+ * Usage: `ConcurrentPOTAccumulator_benchmark [NAdds [MaxThreads]]`
+ *
+ * For 1, 2, 4, ... up to `MaxThreads` (default: 128) threads, each thread
+ * adds `NAdds` summaries (default: 20000), first into a single `POTSummary`
+ * protected by a mutex (as done at the end of subruns), then into its own
+ * shard of a `sumdata::ConcurrentPOTAccumulator`. The throughput of each is
+ * printed. The program fails only if the totals are wrong.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/ConcurrentPOTAccumulator.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+/// Runs `work(iThread)` in `nThreads` threads; returns additions per second.
+template <typename Work>
+double throughput(unsigned int nThreads, std::size_t nAdds, Work work) {
+  using clock_t = std::chrono::steady_clock;
+  std::vector<std::thread> threads;
+  threads.reserve(nThreads);
+  auto const start = clock_t::now();
+  for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+    threads.emplace_back(work, iThread);
+  for (std::thread& thread: threads) thread.join();
+  std::chrono::duration<double> const elapsed = clock_t::now() - start;
+  return nAdds * double(nThreads) / elapsed.count();
+} // throughput()
+
+
+/// Returns whether `total` is the sum of `n` copies of `summary`.
+bool checkTotal(
+  std::string const& name,
+  sumdata::POTSummary const& total, sumdata::POTSummary const& summary,
+  std::size_t n
+) {
+  if ((total.totspills == int(n * summary.totspills))
+    && (total.goodspills == int(n * summary.goodspills))
+    && (total.totpot == n * summary.totpot)
+    && (total.totgoodpot == n * summary.totgoodpot)
+  ) {
+    return true;
+  }
+  std::cerr << "ERROR: " << name << " total is wrong:\n" << total;
+  return false;
+} // checkTotal()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nAdds = (argc > 1)? std::stoul(argv[1]): 20000U;
+  unsigned int const maxThreads = (argc > 2)? std::stoul(argv[2]): 128U;
+
+  sumdata::POTSummary summary;
+  summary.totpot = 4.0e12;
+  summary.totgoodpot = 2.0e12;
+  summary.totspills = 2;
+  summary.goodspills = 1;
+
+  int nErrors = 0;
+  for (unsigned int nThreads = 1U; nThreads <= maxThreads; nThreads *= 2U) {
+
+    sumdata::POTSummary locked;
+    std::mutex lock;
+    double const lockedRate = throughput(nThreads, nAdds,
+      [&](unsigned int){
+        for (std::size_t i = 0; i < nAdds; ++i) {
+          std::lock_guard<std::mutex> guard { lock };
+          locked.aggregate(summary);
+        }
+      });
+
+    sumdata::ConcurrentPOTAccumulator accumulator { nThreads };
+    double const shardedRate = throughput(nThreads, nAdds,
+      [&](unsigned int iThread){
+        for (std::size_t i = 0; i < nAdds; ++i)
+          accumulator.add(iThread, summary);
+      });
+
+    std::cout << std::setw(4) << nThreads << " threads: mutex "
+      << std::setw(10) << std::setprecision(4) << lockedRate
+      << " adds/s, sharded " << std::setw(10) << shardedRate
+      << " adds/s (x" << std::setprecision(3) << (shardedRate / lockedRate)
+      << ")" << std::endl;
+
+    std::size_t const n = nAdds * nThreads;
+    if (!checkTotal("mutex", locked, summary, n)) ++nErrors;
+    if (!checkTotal("sharded", accumulator.summary(), summary, n)) ++nErrors;
+
+  } // for threads
+
+  return nErrors;
+} // main()
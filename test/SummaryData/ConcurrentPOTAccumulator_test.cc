@@ -0,0 +1,97 @@
+/**
+ * @file   ConcurrentPOTAccumulator_test.cc
+ * @brief  Test of `larcoreobj/SummaryData/ConcurrentPOTAccumulator.h`.
+ * @see    larcoreobj/SummaryData/ConcurrentPOTAccumulator.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ConcurrentPOTAccumulator_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/ConcurrentPOTAccumulator.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard libraries
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <stdexcept> // std::out_of_range
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SingleThread_testcase) {
+
+  sumdata::ConcurrentPOTAccumulator accumulator { 3U };
+  BOOST_CHECK_EQUAL(accumulator.nShards(), 3U);
+  BOOST_CHECK_EQUAL(accumulator.summary().totpot, 0.0);
+
+  sumdata::POTSummary summary;
+  summary.totpot = 1.5e12;
+  summary.totgoodpot = 1.0e12;
+  summary.totspills = 3;
+  summary.goodspills = 2;
+
+  accumulator.add(0U, summary);
+  accumulator.add(2U, summary);
+  BOOST_CHECK_THROW(accumulator.add(3U, summary), std::out_of_range);
+
+  sumdata::POTSummary const total = accumulator.summary();
+  BOOST_CHECK_EQUAL(total.totpot, 3.0e12);
+  BOOST_CHECK_EQUAL(total.totgoodpot, 2.0e12);
+  BOOST_CHECK_EQUAL(total.totspills, 6);
+  BOOST_CHECK_EQUAL(total.goodspills, 4);
+
+  accumulator.reset();
+  BOOST_CHECK_EQUAL(accumulator.summary().totspills, 0);
+
+} // BOOST_AUTO_TEST_CASE(SingleThread_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MultiThread_testcase) {
+
+  // each writer adds summaries where good = total / 2, and a reader checks
+  // that all the snapshots it takes are consistent
+  unsigned int const NThreads = 8U;
+  std::size_t const NAdds = 20000U;
+
+  sumdata::ConcurrentPOTAccumulator accumulator { NThreads };
+  std::atomic<bool> done { false };
+  std::atomic<unsigned int> nInconsistent { 0U };
+
+  std::thread reader([&](){
+      while (!done.load()) {
+        sumdata::POTSummary const snapshot = accumulator.summary();
+        if (snapshot.totspills != 2 * snapshot.goodspills) ++nInconsistent;
+        if (snapshot.totpot != 2.0 * snapshot.totgoodpot) ++nInconsistent;
+      }
+    });
+
+  std::vector<std::thread> writers;
+  for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+    writers.emplace_back([&accumulator, iThread, NAdds](){
+        sumdata::POTSummary summary;
+        summary.totpot = 2.0e10;
+        summary.totgoodpot = 1.0e10;
+        summary.totspills = 2;
+        summary.goodspills = 1;
+        for (std::size_t i = 0; i < NAdds; ++i)
+          accumulator.add(iThread, summary);
+      });
+  } // for
+  for (std::thread& writer: writers) writer.join();
+  done = true;
+  reader.join();
+
+  BOOST_CHECK_EQUAL(nInconsistent.load(), 0U);
+
+  sumdata::POTSummary const total = accumulator.summary();
+  BOOST_CHECK_EQUAL(total.totspills, int(2 * NThreads * NAdds));
+  BOOST_CHECK_EQUAL(total.goodspills, int(NThreads * NAdds));
+  BOOST_CHECK_EQUAL(total.totpot, 2.0e10 * NThreads * NAdds);
+  BOOST_CHECK_EQUAL(total.totgoodpot, 1.0e10 * NThreads * NAdds);
+
+} // BOOST_AUTO_TEST_CASE(MultiThread_testcase)
@@ -0,0 +1,117 @@
+/**
+ * @file   GeometryConfigurationCompatibility_test.cc
+ * @brief  Test of `GeometryConfigurationCompatibility.h`.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationCompatibility.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( GeometryConfigurationCompatibility_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationCompatibility.h"
+#include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+
+// C/C++ standard libraries
+#include <string>
+
+
+//------------------------------------------------------------------------------
+sumdata::GeometryConfigurationInfo makeInfo(
+  std::string const& detector, std::string const& config,
+  sumdata::GeometryConfigurationInfo::DataVersion_t version = 2U
+) {
+  sumdata::GeometryConfigurationInfo info;
+  info.dataVersion = version;
+  info.detectorName = detector;
+  if (version >= 2U) info.setServiceConfiguration(config, version >= 3U);
+  return info;
+} // makeInfo()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CanonicalDigest_testcase) {
+
+  // white space and parameter order do not matter
+  BOOST_CHECK(
+    sumdata::canonicalConfigurationDigest
+      (makeInfo("sbnd", "SurfaceY: 690 GDML: \"sbnd.gdml\""))
+    == sumdata::canonicalConfigurationDigest
+      (makeInfo("sbnd", "GDML:  \"sbnd.gdml\"\n\n  SurfaceY:690", 3U))
+    );
+  BOOST_CHECK(
+    sumdata::canonicalConfigurationDigest
+      (makeInfo("sbnd", "SurfaceY: 690 GDML: \"sbnd.gdml\""))
+    != sumdata::canonicalConfigurationDigest
+      (makeInfo("sbnd", "SurfaceY: 691 GDML: \"sbnd.gdml\""))
+    );
+
+} // BOOST_AUTO_TEST_CASE(CanonicalDigest_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompatibleGeometryConfigurations_testcase) {
+
+  auto const reference = makeInfo("icarus", "SurfaceY: 690 Cryostats: 2");
+
+  BOOST_CHECK(sumdata::compatibleGeometryConfigurations
+    (reference, makeInfo("icarus", "Cryostats: 2   SurfaceY: 690", 3U)));
+  BOOST_CHECK(!sumdata::compatibleGeometryConfigurations
+    (reference, makeInfo("icarus", "SurfaceY: 690 Cryostats: 1")));
+  BOOST_CHECK(!sumdata::compatibleGeometryConfigurations
+    (reference, makeInfo("sbnd", "SurfaceY: 690 Cryostats: 2")));
+
+  // legacy information only has the detector name
+  BOOST_CHECK(sumdata::compatibleGeometryConfigurations
+    (reference, makeInfo("icarus", "", 1U)));
+  BOOST_CHECK(!sumdata::compatibleGeometryConfigurations
+    (reference, makeInfo("sbnd", "", 1U)));
+
+  BOOST_CHECK(!sumdata::compatibleGeometryConfigurations
+    (reference, sumdata::GeometryConfigurationInfo{}));
+
+} // BOOST_AUTO_TEST_CASE(CompatibleGeometryConfigurations_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GeometryCompatibilityChecker_testcase) {
+
+  sumdata::GeometryCompatibilityChecker const checker
+    { makeInfo("icarus", "SurfaceY: 690 Cryostats: 2") };
+  BOOST_CHECK_EQUAL(checker.reference().detectorName, "icarus");
+  BOOST_CHECK_EQUAL(checker.nKnownConfigurations(), 0U);
+
+  for (int i = 0; i < 10; ++i) {
+    BOOST_CHECK(checker.isCompatible
+      (makeInfo("icarus", "Cryostats: 2 SurfaceY: 690", 3U)));
+    BOOST_CHECK(!checker.isCompatible
+      (makeInfo("icarus", "Cryostats: 1 SurfaceY: 690", 3U)));
+    BOOST_CHECK(checker.isCompatible(makeInfo("icarus", "", 1U)));
+  }
+  BOOST_CHECK_EQUAL(checker.nKnownConfigurations(), 3U);
+
+  // the same object is digested only once
+  auto const info = makeInfo("icarus", "SurfaceY: 690 Cryostats: 2", 3U);
+  BOOST_CHECK(checker.isCompatible(info));
+  sumdata::ContentDigest const& digest = info.contentDigest();
+  BOOST_CHECK_EQUAL(digest, sumdata::geometryConfigurationDigest(info));
+  BOOST_CHECK(checker.isCompatible(info));
+  BOOST_CHECK(&info.contentDigest() == &digest);
+  BOOST_CHECK_EQUAL(checker.nKnownConfigurations(), 4U);
+
+  // a modified copy is digested anew, not with the digest of the original
+  sumdata::GeometryConfigurationInfo other = info;
+  other.detectorName = "sbnd";
+  BOOST_CHECK(!sumdata::compatibleGeometryConfigurations(info, other));
+  BOOST_CHECK(!checker.isCompatible(other));
+  BOOST_CHECK(other.contentDigest() != digest);
+  BOOST_CHECK_EQUAL(checker.nKnownConfigurations(), 5U);
+
+  sumdata::DigestedGeometryConfiguration const digested { info };
+  BOOST_CHECK_EQUAL(digested.digest(), digest);
+  BOOST_CHECK(checker.isCompatible(digested));
+  BOOST_CHECK(!checker.isCompatible(sumdata::DigestedGeometryConfiguration{}));
+  BOOST_CHECK_EQUAL(checker.nKnownConfigurations(), 5U);
+
+} // BOOST_AUTO_TEST_CASE(GeometryCompatibilityChecker_testcase)
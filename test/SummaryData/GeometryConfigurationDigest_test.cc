@@ -0,0 +1,124 @@
+/**
+ * @file   GeometryConfigurationDigest_test.cc
+ * @brief  Test of `larcoreobj/SummaryData/GeometryConfigurationDigest.h`.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationDigest.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( GeometryConfigurationDigest_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationDigest.h"
+#include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+
+// C/C++ standard libraries
+#include <thread>
+#include <vector>
+#include <string>
+
+
+//------------------------------------------------------------------------------
+sumdata::GeometryConfigurationInfo makeInfo
+  (std::string const& detector, std::string const& config)
+{
+  sumdata::GeometryConfigurationInfo info;
+  info.dataVersion = 2U;
+  info.detectorName = detector;
+  info.geometryServiceConfiguration = config;
+  return info;
+} // makeInfo()
+
+
+std::string makeConfiguration(unsigned int nPlanes) {
+  std::string config = "GDML: \"detector.gdml\" SurfaceY: 690 Planes: [";
+  for (unsigned int i = 0; i < nPlanes; ++i)
+    config += " { view: " + std::to_string(i % 3) + " angle: 60 },";
+  return config + " ]";
+} // makeConfiguration()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ContentDigest_testcase) {
+
+  // reference values of MurmurHash3_x64_128 (seed 0)
+  BOOST_CHECK_EQUAL(sumdata::ContentDigest::of("").toString(),
+    "00000000000000000000000000000000");
+  BOOST_CHECK_EQUAL(sumdata::ContentDigest::of("hello").toString(),
+    "5b1e906a48ae1d19cbd8a7b341bd9b02");
+
+  sumdata::ContentDigest const a = sumdata::ContentDigest::of("abc");
+  BOOST_CHECK(a == sumdata::ContentDigest::of(std::string{ "abc" }));
+  BOOST_CHECK(a != sumdata::ContentDigest::of("abd"));
+  BOOST_CHECK(a != sumdata::ContentDigest::of("abc", 1U));
+
+  // name and configuration are not simply concatenated
+  BOOST_CHECK(sumdata::geometryConfigurationDigest(makeInfo("ab", "c"))
+    != sumdata::geometryConfigurationDigest(makeInfo("a", "bc")));
+
+} // BOOST_AUTO_TEST_CASE(ContentDigest_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(DigestedGeometryConfiguration_testcase) {
+
+  sumdata::DigestedGeometryConfiguration const a
+    { makeInfo("icarus", makeConfiguration(100U)) };
+  sumdata::DigestedGeometryConfiguration const b
+    { makeInfo("icarus", makeConfiguration(100U)) };
+  sumdata::DigestedGeometryConfiguration const c
+    { makeInfo("icarus", makeConfiguration(101U)) };
+
+  BOOST_CHECK(a.hasInfo());
+  BOOST_CHECK(&a.info() != &b.info());
+  BOOST_CHECK(a.digest() == b.digest());
+  BOOST_CHECK(a == b);
+  BOOST_CHECK(a.digest() != c.digest());
+  BOOST_CHECK(a != c);
+  BOOST_CHECK(!sumdata::DigestedGeometryConfiguration{}.hasInfo());
+  BOOST_CHECK(a != sumdata::DigestedGeometryConfiguration{});
+
+  sumdata::DigestedGeometryConfiguration const copy = a;
+  BOOST_CHECK(&copy.info() == &a.info());
+  BOOST_CHECK(copy == a);
+
+} // BOOST_AUTO_TEST_CASE(DigestedGeometryConfiguration_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GeometryConfigurationStore_testcase) {
+
+  sumdata::GeometryConfigurationStore store;
+  BOOST_CHECK_EQUAL(store.size(), 0U);
+
+  // many threads add the same few configurations
+  unsigned int const NThreads = 8U;
+  unsigned int const NConfigs = 4U;
+  std::vector<std::vector<sumdata::DigestedGeometryConfiguration>> results
+    (NThreads);
+  std::vector<std::thread> threads;
+  for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+    threads.emplace_back([&store, &results, iThread, NConfigs](){
+        for (unsigned int i = 0; i < 50U; ++i) {
+          unsigned int const iConfig = (i + iThread) % NConfigs;
+          results[iThread].push_back(store.add
+            (makeInfo("sbnd", makeConfiguration(10U + iConfig))));
+        }
+      });
+  }
+  for (std::thread& thread: threads) thread.join();
+
+  BOOST_CHECK_EQUAL(store.size(), NConfigs);
+
+  // all equal configurations share the same object
+  for (auto const& threadResults: results) {
+    for (auto const& config: threadResults) {
+      sumdata::DigestedGeometryConfiguration const stored
+        = store.add(config.info());
+      BOOST_CHECK(&stored.info() == &config.info());
+    }
+  }
+  BOOST_CHECK_EQUAL(store.size(), NConfigs);
+
+} // BOOST_AUTO_TEST_CASE(GeometryConfigurationStore_testcase)
@@ -0,0 +1,178 @@
+/**
+ * @file   GeometryConfigurationInfo_test.cc
+ * @brief  Test of `larcoreobj/SummaryData/GeometryConfigurationInfo.h`.
+ * @see    larcoreobj/SummaryData/GeometryConfigurationInfo.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( GeometryConfigurationInfo_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/GeometryConfigurationInfo.h"
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept> // std::runtime_error
+
+
+//------------------------------------------------------------------------------
+std::string makeConfiguration(unsigned int nPlanes) {
+  std::string config = "GDML: \"detector.gdml\" SurfaceY: 690 Planes: [";
+  for (unsigned int i = 0; i < nPlanes; ++i)
+    config += " { view: " + std::to_string(i % 3) + " angle: 60 },";
+  return config + " ]";
+} // makeConfiguration()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PlainConfiguration_testcase) {
+
+  sumdata::GeometryConfigurationInfo info;
+  info.dataVersion = 2U;
+  info.detectorName = "icarus";
+  info.geometryServiceConfiguration = makeConfiguration(10U);
+
+  BOOST_CHECK(!info.isConfigurationCompressed());
+  BOOST_CHECK_EQUAL(info.serviceConfiguration(), makeConfiguration(10U));
+  BOOST_CHECK
+    (&info.serviceConfiguration() == &info.geometryServiceConfiguration);
+
+  info.setServiceConfiguration(makeConfiguration(12U));
+  BOOST_CHECK(!info.isConfigurationCompressed());
+  BOOST_CHECK_EQUAL(info.geometryServiceConfiguration, makeConfiguration(12U));
+  BOOST_CHECK_EQUAL(info.dataVersion, 2U);
+  BOOST_CHECK_EQUAL(info.serviceConfiguration(), makeConfiguration(12U));
+
+} // BOOST_AUTO_TEST_CASE(PlainConfiguration_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompressedConfiguration_testcase) {
+
+  std::string const config = makeConfiguration(1000U);
+
+  sumdata::GeometryConfigurationInfo info;
+  info.dataVersion = 2U;
+  info.detectorName = "icarus";
+  info.setServiceConfiguration(config, true);
+
+  BOOST_CHECK_EQUAL(info.dataVersion, 3U);
+  BOOST_CHECK(info.isConfigurationCompressed());
+  BOOST_CHECK(info.geometryServiceConfiguration.empty());
+  BOOST_CHECK_LT
+    (info.compressedServiceConfiguration.size(), config.size() / 10U);
+
+  // the decompressed string is cached, but not shared by copies
+  std::string const& decoded = info.serviceConfiguration();
+  BOOST_CHECK_EQUAL(decoded, config);
+  BOOST_CHECK(&info.serviceConfiguration() == &decoded);
+  sumdata::GeometryConfigurationInfo const copy = info;
+  BOOST_CHECK(&copy.serviceConfiguration() != &decoded);
+  BOOST_CHECK_EQUAL(copy.serviceConfiguration(), config);
+
+  // a copy edited directly does not see the cache of the original
+  sumdata::GeometryConfigurationInfo other;
+  other.setServiceConfiguration(makeConfiguration(10U), true);
+  sumdata::GeometryConfigurationInfo edited = info;
+  edited.compressedServiceConfiguration = other.compressedServiceConfiguration;
+  BOOST_CHECK_EQUAL(edited.serviceConfiguration(), makeConfiguration(10U));
+  BOOST_CHECK_EQUAL(info.serviceConfiguration(), config);
+
+  // neither does a copy assigned after its cache was filled
+  edited = info;
+  BOOST_CHECK_EQUAL(edited.serviceConfiguration(), config);
+  BOOST_CHECK(&edited.serviceConfiguration() != &decoded);
+
+  // concurrent first access
+  sumdata::GeometryConfigurationInfo fresh = copy;
+  fresh.setServiceConfiguration(makeConfiguration(999U), true);
+  std::vector<std::string const*> results(8U, nullptr);
+  std::vector<std::thread> threads;
+  for (std::string const*& result: results) {
+    threads.emplace_back
+      ([&fresh, &result](){ result = &fresh.serviceConfiguration(); });
+  }
+  for (std::thread& thread: threads) thread.join();
+  BOOST_CHECK_EQUAL(*results.front(), makeConfiguration(999U));
+  for (std::string const* result: results)
+    BOOST_CHECK(result == results.front());
+
+  // back to plain text
+  fresh.setServiceConfiguration(config, false);
+  BOOST_CHECK(!fresh.isConfigurationCompressed());
+  BOOST_CHECK_EQUAL(fresh.serviceConfiguration(), config);
+
+  // printout shows the decompressed configuration
+  std::ostringstream sstr;
+  sstr << info;
+  BOOST_CHECK(sstr.str().find(config) != std::string::npos);
+  BOOST_CHECK(sstr.str().find("can't") == std::string::npos);
+
+} // BOOST_AUTO_TEST_CASE(CompressedConfiguration_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CorruptedConfiguration_testcase) {
+
+  sumdata::GeometryConfigurationInfo info;
+  info.setServiceConfiguration(makeConfiguration(10U), true);
+  info.compressedServiceConfiguration.resize
+    (info.compressedServiceConfiguration.size() / 2);
+  BOOST_CHECK_THROW(info.serviceConfiguration(), std::runtime_error);
+
+  sumdata::GeometryConfigurationInfo truncated;
+  truncated.compressedServiceConfiguration.assign(4U, 0);
+  BOOST_CHECK_THROW(truncated.serviceConfiguration(), std::runtime_error);
+
+  // a header declaring a huge size is rejected before allocating
+  sumdata::GeometryConfigurationInfo huge;
+  huge.setServiceConfiguration(makeConfiguration(10U), true);
+  for (std::size_t i = 0; i < 8U; ++i)
+    huge.compressedServiceConfiguration[i] = 0xFF;
+  BOOST_CHECK_THROW(huge.serviceConfiguration(), std::runtime_error);
+
+  // a header declaring a size different from the actual one is rejected
+  sumdata::GeometryConfigurationInfo wrongSize;
+  wrongSize.setServiceConfiguration(makeConfiguration(10U), true);
+  --wrongSize.compressedServiceConfiguration[0];
+  BOOST_CHECK_THROW(wrongSize.serviceConfiguration(), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(CorruptedConfiguration_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ServiceParameters_testcase) {
+
+  sumdata::GeometryConfigurationInfo info;
+  info.dataVersion = 2U;
+  info.detectorName = "icarus";
+  info.setServiceConfiguration
+    ("SurfaceY: 690 Builder: { tool_type: \"GeoObjectSorter\" Depth: 3 }");
+
+  fhicl::ParameterSet const& pset = info.serviceParameters();
+  BOOST_CHECK_EQUAL(pset.get<int>("SurfaceY"), 690);
+  BOOST_CHECK_EQUAL(pset.get<unsigned int>("Builder.Depth"), 3U);
+  BOOST_CHECK_EQUAL
+    (pset.get<std::string>("Builder.tool_type"), "GeoObjectSorter");
+  BOOST_CHECK(!pset.has_key("GDML"));
+
+  // parsed once, not shared by copies
+  sumdata::GeometryConfigurationInfo const copy = info;
+  BOOST_CHECK(&info.serviceParameters() == &pset);
+  BOOST_CHECK(&copy.serviceParameters() != &pset);
+  BOOST_CHECK_EQUAL(copy.serviceParameters().get<int>("SurfaceY"), 690);
+
+  // a new configuration is parsed anew
+  info.setServiceConfiguration("SurfaceY: 700", false);
+  BOOST_CHECK_EQUAL(info.serviceParameters().get<int>("SurfaceY"), 700);
+  BOOST_CHECK_EQUAL(copy.serviceParameters().get<int>("SurfaceY"), 690);
+
+} // BOOST_AUTO_TEST_CASE(ServiceParameters_testcase)
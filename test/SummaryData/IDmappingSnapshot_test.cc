@@ -0,0 +1,234 @@
+/**
+ * @file   IDmappingSnapshot_test.cc
+ * @brief  Test of `larcoreobj/SummaryData/IDmappingSnapshot.h`.
+ * @see    larcoreobj/SummaryData/IDmappingSnapshot.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( IDmappingSnapshot_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/IDmappingSnapshot.h"
+#include "larcoreobj/SummaryData/GeometryConfigurationDigest.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_geo_mapping.h"
+
+// C/C++ standard libraries
+#include <fstream>
+#include <iterator> // std::istreambuf_iterator
+#include <vector>
+#include <string>
+#include <utility> // std::move()
+#include <stdexcept> // std::runtime_error
+#include <cstdio> // std::remove()
+#include <cstdint> // std::uint64_t
+
+
+//------------------------------------------------------------------------------
+readout::ChannelWireMapping makeChannelWireMapping() {
+  // one TPC with two planes of 4 wires each; wires 0 and 3 of the first plane
+  // are on the same channel, and wire 2 of the second plane is missing
+  return { 7U, readout::WireLayout{{ 1U, 1U, 2U, 4U }}, {
+    { 0U, geo::WireID{ 0U, 0U, 0U, 3U } },
+    { 0U, geo::WireID{ 0U, 0U, 0U, 0U } },
+    { 1U, geo::WireID{ 0U, 0U, 0U, 1U } },
+    { 2U, geo::WireID{ 0U, 0U, 0U, 2U } },
+    { 3U, geo::WireID{ 0U, 0U, 1U, 0U } },
+    { 4U, geo::WireID{ 0U, 0U, 1U, 1U } },
+    { 6U, geo::WireID{ 0U, 0U, 1U, 3U } }
+    }};
+} // makeChannelWireMapping()
+
+
+readout::ROPplaneMapping makeROPplaneMapping() {
+  // two TPCs sharing the readout of their induction planes
+  return {
+    readout::ROPlayout{{ 1U, 1U, 3U }}, readout::PlaneLayout{{ 1U, 2U, 2U }},
+    {
+      { readout::ROPID{ 0U, 0U, 0U }, geo::PlaneID{ 0U, 1U, 0U } },
+      { readout::ROPID{ 0U, 0U, 0U }, geo::PlaneID{ 0U, 0U, 0U } },
+      { readout::ROPID{ 0U, 0U, 1U }, geo::PlaneID{ 0U, 0U, 1U } },
+      { readout::ROPID{ 0U, 0U, 2U }, geo::PlaneID{ 0U, 1U, 1U } }
+    }
+  };
+} // makeROPplaneMapping()
+
+
+/// Overwrites the byte at `offset` of the file in `path`.
+void corruptFile(std::string const& path, std::streamoff offset) {
+  std::fstream file { path, std::ios::in | std::ios::out | std::ios::binary };
+  file.seekg(offset);
+  char const c = static_cast<char>(file.get() ^ 0x5A);
+  file.seekp(offset);
+  file.put(c);
+} // corruptFile()
+
+
+/// Replaces in the file in `path` the first occurrence of `from` with `to`.
+template <typename T>
+void replaceInFile(
+  std::string const& path,
+  std::vector<T> const& from, std::vector<T> const& to
+) {
+  std::string content;
+  {
+    std::ifstream file { path, std::ios::binary };
+    content.assign(std::istreambuf_iterator<char>{ file }, {});
+  }
+  std::string const fromBytes
+    { reinterpret_cast<char const*>(from.data()), from.size() * sizeof(T) };
+  std::size_t const pos = content.find(fromBytes);
+  BOOST_REQUIRE_NE(pos, std::string::npos);
+  BOOST_REQUIRE_EQUAL(from.size(), to.size());
+  std::fstream file { path, std::ios::in | std::ios::out | std::ios::binary };
+  file.seekp(pos);
+  file.write(reinterpret_cast<char const*>(to.data()), to.size() * sizeof(T));
+} // replaceInFile()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IDmappingSnapshot_testcase) {
+
+  std::string const path = "IDmappingSnapshot_test.snapshot";
+  sumdata::ContentDigest const digest
+    = sumdata::ContentDigest::of("test geometry");
+
+  readout::ChannelWireMapping const channelWires = makeChannelWireMapping();
+  readout::ROPplaneMapping const ROPplanes = makeROPplaneMapping();
+  sumdata::IDmappingSnapshot::write
+    (path, digest, channelWires.view(), ROPplanes.view());
+
+  sumdata::IDmappingSnapshot snapshot { path, digest, true };
+  BOOST_CHECK_EQUAL(snapshot.geometryDigest(), digest);
+
+  readout::ChannelWireMappingView const& wires = snapshot.channelWireMapping();
+  BOOST_CHECK_EQUAL(wires.nChannels(), channelWires.nChannels());
+  for (raw::ChannelID_t channel = 0U; channel < 8U; ++channel) {
+    BOOST_TEST_CONTEXT("Channel " << channel) {
+      auto const expected = channelWires.wires(channel);
+      auto const actual = wires.wires(channel);
+      BOOST_CHECK_EQUAL_COLLECTIONS
+        (actual.begin(), actual.end(), expected.begin(), expected.end());
+    }
+  } // for channels
+  BOOST_CHECK_EQUAL
+    (wires.channel(geo::WireID{ 0U, 0U, 0U, 3U }), raw::ChannelID_t(0U));
+  BOOST_CHECK_EQUAL
+    (wires.channel(geo::WireID{ 0U, 0U, 1U, 2U }), raw::InvalidChannelID);
+
+  readout::ROPplaneMappingView const& planes = snapshot.ROPplaneMapping();
+  BOOST_CHECK_EQUAL(planes.nPairs(), 4U);
+  auto const inductionPlanes = planes.planes(readout::ROPID{ 0U, 0U, 0U });
+  BOOST_CHECK_EQUAL(inductionPlanes.size(), 2U);
+  BOOST_CHECK_EQUAL(inductionPlanes[1U], (geo::PlaneID{ 0U, 1U, 0U }));
+  BOOST_CHECK_EQUAL
+    (planes.ROP(geo::PlaneID{ 0U, 1U, 1U }), (readout::ROPID{ 0U, 0U, 2U }));
+
+  // the views survive moving the snapshot
+  sumdata::IDmappingSnapshot const moved { std::move(snapshot) };
+  BOOST_CHECK_EQUAL(moved.channelWireMapping().wires(0U).size(), 2U);
+  BOOST_CHECK_EQUAL(snapshot.size(), 0U);
+
+  // wrong geometry
+  BOOST_CHECK_THROW(
+    (sumdata::IDmappingSnapshot{
+      path, sumdata::ContentDigest::of("other geometry") }),
+    std::runtime_error
+    );
+
+  // corrupted table: detected only when checking the content
+  corruptFile(path, moved.size() - 1);
+  BOOST_CHECK_NO_THROW((sumdata::IDmappingSnapshot{ path, digest }));
+  BOOST_CHECK_THROW
+    ((sumdata::IDmappingSnapshot{ path, digest, true }), std::runtime_error);
+
+  // not a snapshot
+  corruptFile(path, 0);
+  BOOST_CHECK_THROW
+    ((sumdata::IDmappingSnapshot{ path, digest }), std::runtime_error);
+
+  std::remove(path.c_str());
+  BOOST_CHECK_THROW
+    ((sumdata::IDmappingSnapshot{ path, digest }), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(IDmappingSnapshot_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IDmappingSnapshotOffsets_testcase) {
+
+  std::string const path = "IDmappingSnapshotOffsets_test.snapshot";
+  sumdata::ContentDigest const digest;
+
+  readout::ChannelWireMapping const channelWires = makeChannelWireMapping();
+  sumdata::IDmappingSnapshot::write
+    (path, digest, channelWires.view(), makeROPplaneMapping().view());
+
+  // the first and last offsets are still right, but the second channel
+  // would end past the wire table and the third one would end before starting
+  replaceInFile<geo::CSRoffset_t>(path,
+    { 0U, 2U, 3U, 4U, 5U, 6U, 6U, 7U },
+    { 0U, 2U, 9U, 4U, 5U, 6U, 6U, 7U }
+    );
+  BOOST_CHECK_THROW
+    ((sumdata::IDmappingSnapshot{ path, digest }), std::runtime_error);
+
+  std::remove(path.c_str());
+
+} // BOOST_AUTO_TEST_CASE(IDmappingSnapshotOffsets_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IDmappingSnapshotExtents_testcase) {
+
+  std::string const path = "IDmappingSnapshotExtents_test.snapshot";
+  sumdata::ContentDigest const digest;
+
+  readout::ChannelWireMapping const channelWires = makeChannelWireMapping();
+  auto const write = [&](){
+    sumdata::IDmappingSnapshot::write
+      (path, digest, channelWires.view(), makeROPplaneMapping().view());
+  };
+  std::vector<std::uint64_t> const wireLayout { 1U, 1U, 2U, 4U };
+
+  // the size of this layout wraps to 8, the actual size of the wire table
+  write();
+  replaceInFile<std::uint64_t>
+    (path, wireLayout, { (std::uint64_t{ 1U } << 63U) + 1U, 1U, 2U, 4U });
+  BOOST_CHECK_THROW
+    ((sumdata::IDmappingSnapshot{ path, digest }), std::runtime_error);
+
+  // extents must be valid indices
+  write();
+  replaceInFile<std::uint64_t>
+    (path, wireLayout, { geo::PackedIDinvalidIndex, 1U, 2U, 4U });
+  BOOST_CHECK_THROW
+    ((sumdata::IDmappingSnapshot{ path, digest }), std::runtime_error);
+
+  std::remove(path.c_str());
+
+} // BOOST_AUTO_TEST_CASE(IDmappingSnapshotExtents_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IDmappingSnapshotEmpty_testcase) {
+
+  std::string const path = "IDmappingSnapshotEmpty_test.snapshot";
+  sumdata::ContentDigest const digest;
+
+  sumdata::IDmappingSnapshot::write
+    (path, digest, readout::ChannelWireMappingView{},
+     readout::ROPplaneMappingView{});
+
+  sumdata::IDmappingSnapshot const snapshot { path, digest, true };
+  BOOST_CHECK_EQUAL(snapshot.channelWireMapping().nChannels(), 0U);
+  BOOST_CHECK(snapshot.channelWireMapping().wires(0U).empty());
+  BOOST_CHECK_EQUAL(snapshot.ROPplaneMapping().nPairs(), 0U);
+
+  std::remove(path.c_str());
+
+} // BOOST_AUTO_TEST_CASE(IDmappingSnapshotEmpty_testcase)
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,193 @@
+/**
+ * @file   POTAggregation_test.cc
+ * @brief  Test of `larcoreobj/SummaryData/POTAggregation.h`.
+ * @see    larcoreobj/SummaryData/POTAggregation.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( POTAggregation_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTAggregation.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+#include <algorithm> // std::shuffle(), std::reverse()
+#include <limits> // std::numeric_limits<>
+#include <stdexcept> // std::overflow_error
+#include <cmath> // std::isnan(), std::ldexp()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+/// Returns `n` summaries with exposures spanning several orders of magnitude.
+std::vector<sumdata::POTSummary> makeSummaries(std::size_t n) {
+  std::mt19937 engine { 4321U };
+  std::lognormal_distribution<double> potDist { 37.0, 3.0 };
+  std::uniform_int_distribution<int> spillDist { 0, 1000 };
+  std::vector<sumdata::POTSummary> summaries(n);
+  for (sumdata::POTSummary& summary: summaries) {
+    summary.totpot = potDist(engine);
+    summary.totgoodpot = 0.9 * summary.totpot;
+    summary.totspills = spillDist(engine);
+    summary.goodspills = summary.totspills / 2;
+  }
+  return summaries;
+} // makeSummaries()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompensatedSum_testcase) {
+
+  // 1 + n * (epsilon/2): plain summation loses all the small addends
+  std::size_t const N = 1000;
+  double const tiny = std::numeric_limits<double>::epsilon() / 2.0;
+
+  sumdata::details::CompensatedSum sum;
+  double plain = 1.0;
+  sum.add(1.0);
+  for (std::size_t i = 0; i < N; ++i) {
+    sum.add(tiny);
+    plain += tiny;
+  }
+  BOOST_CHECK_EQUAL(plain, 1.0);
+  BOOST_CHECK_EQUAL(sum.value(), 1.0 + N * tiny);
+
+  // combination of partial sums
+  sumdata::details::CompensatedSum first, second;
+  first.add(1.0);
+  for (std::size_t i = 0; i < N; ++i) second.add(tiny);
+  first.combine(second);
+  BOOST_CHECK_EQUAL(first.value(), sum.value());
+
+} // BOOST_AUTO_TEST_CASE(CompensatedSum_testcase)
+
+
+//------------------------------------------------------------------------------
+/// Returns the exact sum of `values`, in this order.
+double exactSum(std::vector<double> const& values) {
+  sumdata::details::ExactSum sum;
+  for (double value: values) sum.add(value);
+  return sum.value();
+} // exactSum()
+
+
+BOOST_AUTO_TEST_CASE(ExactSum_testcase) {
+
+  double const epsilon = std::numeric_limits<double>::epsilon();
+  double const denormal = std::numeric_limits<double>::denorm_min();
+  double const huge = std::numeric_limits<double>::max();
+  double const inf = std::numeric_limits<double>::infinity();
+
+  BOOST_CHECK_EQUAL(sumdata::details::ExactSum{}.value(), 0.0);
+
+  // cancellations
+  BOOST_CHECK_EQUAL(exactSum({ 1e100, 1.0, -1e100 }), 1.0);
+  BOOST_CHECK_EQUAL(exactSum({ huge, huge, -huge }), huge);
+  BOOST_CHECK_EQUAL(exactSum({ 3.0, -5.0 }), -2.0);
+  BOOST_CHECK_EQUAL(exactSum({ 0.5, -1e-300, 1e-300, -0.5 }), 0.0);
+  BOOST_CHECK_EQUAL(exactSum({ -denormal, -denormal, denormal }), -denormal);
+  BOOST_CHECK_EQUAL(exactSum({ denormal, denormal, denormal }), 3 * denormal);
+
+  // rounding, to nearest with ties to even
+  BOOST_CHECK_EQUAL(exactSum({ 1.0, epsilon / 2.0 }), 1.0);
+  BOOST_CHECK_EQUAL
+    (exactSum({ 1.0 + epsilon, epsilon / 2.0 }), 1.0 + 2 * epsilon);
+  BOOST_CHECK_EQUAL
+    (exactSum({ 1.0, epsilon / 2.0, epsilon / 1024.0 }), 1.0 + epsilon);
+  BOOST_CHECK_EQUAL
+    (exactSum({ 1.0, epsilon / 2.0, 1e-300 }), 1.0 + epsilon);
+  BOOST_CHECK_EQUAL
+    (exactSum({ -1.0, -epsilon / 2.0, -1e-300 }), -1.0 - epsilon);
+  BOOST_CHECK_EQUAL(exactSum({ huge, huge }), inf);
+
+  // non-finite values
+  BOOST_CHECK_EQUAL(exactSum({ 1.0, inf, 2.0 }), inf);
+  BOOST_CHECK(std::isnan(exactSum({ inf, 1.0, -inf })));
+
+  // independent of order and of splitting
+  std::mt19937 engine { 1234U };
+  std::uniform_real_distribution<double> mantissaDist { -1.0, 1.0 };
+  std::uniform_int_distribution<int> exponentDist { -60, 60 };
+  std::vector<double> values(10000);
+  for (double& value: values)
+    value = std::ldexp(mantissaDist(engine), exponentDist(engine));
+  double const expected = exactSum(values);
+  std::shuffle(values.begin(), values.end(), engine);
+  BOOST_CHECK_EQUAL(exactSum(values), expected);
+
+  sumdata::details::ExactSum first, second;
+  for (std::size_t i = 0; i < values.size(); ++i)
+    (i % 3 == 0? first: second).add(values[i]);
+  second.combine(first);
+  BOOST_CHECK_EQUAL(second.value(), expected);
+
+} // BOOST_AUTO_TEST_CASE(ExactSum_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(aggregatePOT_testcase) {
+
+  std::size_t const N = 20 * sumdata::POTAggregationBlockSize + 17;
+  std::vector<sumdata::POTSummary> summaries = makeSummaries(N);
+
+  // reference: legacy sequential aggregation (exposure within rounding)
+  sumdata::POTSummary expected;
+  for (sumdata::POTSummary const& summary: summaries)
+    expected.aggregate(summary);
+
+  sumdata::POTSummary const result = sumdata::aggregatePOT(summaries, 1U);
+  BOOST_CHECK_CLOSE(result.totpot, expected.totpot, 1e-10);
+  BOOST_CHECK_CLOSE(result.totgoodpot, expected.totgoodpot, 1e-10);
+  BOOST_CHECK_EQUAL(result.totspills, expected.totspills);
+  BOOST_CHECK_EQUAL(result.goodspills, expected.goodspills);
+
+  // bit-by-bit the same with any number of threads
+  for (unsigned int const nThreads: { 0U, 2U, 3U, 8U, 64U }) {
+    sumdata::POTSummary const threaded
+      = sumdata::aggregatePOT(summaries, nThreads);
+    BOOST_TEST_MESSAGE("Threads: " << nThreads);
+    BOOST_CHECK_EQUAL(threaded.totpot, result.totpot);
+    BOOST_CHECK_EQUAL(threaded.totgoodpot, result.totgoodpot);
+    BOOST_CHECK_EQUAL(threaded.totspills, result.totspills);
+    BOOST_CHECK_EQUAL(threaded.goodspills, result.goodspills);
+  } // for threads
+
+  // bit-by-bit the same with the input in any order
+  std::mt19937 engine { 98U };
+  for (unsigned int const nThreads: { 1U, 4U }) {
+    std::shuffle(summaries.begin(), summaries.end(), engine);
+    sumdata::POTSummary const shuffled
+      = sumdata::aggregatePOT(summaries, nThreads);
+    BOOST_CHECK_EQUAL(shuffled.totpot, result.totpot);
+    BOOST_CHECK_EQUAL(shuffled.totgoodpot, result.totgoodpot);
+    BOOST_CHECK_EQUAL(shuffled.totspills, result.totspills);
+  }
+  std::reverse(summaries.begin(), summaries.end());
+  BOOST_CHECK_EQUAL(sumdata::aggregatePOT(summaries).totpot, result.totpot);
+
+  // empty input
+  sumdata::POTSummary const empty = sumdata::aggregatePOT(nullptr, 0U, 4U);
+  BOOST_CHECK_EQUAL(empty.totpot, 0.0);
+  BOOST_CHECK_EQUAL(empty.totspills, 0);
+
+} // BOOST_AUTO_TEST_CASE(aggregatePOT_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTAggregatorOverflow_testcase) {
+
+  sumdata::POTSummary big;
+  big.totspills = std::numeric_limits<int>::max();
+
+  sumdata::POTAggregator aggregator;
+  aggregator.add(big);
+  BOOST_CHECK_EQUAL(aggregator.summary().totspills, big.totspills);
+  aggregator.add(big);
+  BOOST_CHECK_THROW(aggregator.summary(), std::overflow_error);
+
+} // BOOST_AUTO_TEST_CASE(POTAggregatorOverflow_testcase)
@@ -0,0 +1,271 @@
+/**
+ * @file   POTRangeIndex_test.cc
+ * @brief  Test of `larcoreobj/SummaryData/POTRangeIndex.h`.
+ * @see    larcoreobj/SummaryData/POTRangeIndex.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( POTRangeIndex_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/POTRangeIndex.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm> // std::shuffle()
+#include <random>
+#include <tuple> // std::tie()
+#include <stdexcept> // std::invalid_argument, std::out_of_range, ...
+
+
+//------------------------------------------------------------------------------
+/// Stand-in for `art::SubRunID`, with the same interface used by the index.
+class SubRunID {
+  unsigned int fRun, fSubRun;
+  public:
+  SubRunID(unsigned int run, unsigned int subRun)
+    : fRun(run), fSubRun(subRun) {}
+  unsigned int run() const { return fRun; }
+  unsigned int subRun() const { return fSubRun; }
+  bool operator< (SubRunID const& other) const
+    { return std::tie(fRun, fSubRun) < std::tie(other.fRun, other.fSubRun); }
+}; // class SubRunID
+
+
+/// Summary of a subrun with a recognizable content.
+sumdata::POTSummary makeSummary(unsigned int run, unsigned int subRun) {
+  sumdata::POTSummary summary;
+  summary.totpot = 1.0e12 * run + 1.0e6 * subRun + 0.1;
+  summary.totgoodpot = 0.5 * summary.totpot;
+  summary.totspills = int(run + subRun);
+  summary.goodspills = int(subRun);
+  return summary;
+} // makeSummary()
+
+
+/// Sequential sum of the summaries of subruns between two keys (included).
+sumdata::POTSummary referenceSum(
+  std::map<SubRunID, sumdata::POTSummary> const& summaries,
+  SubRunID const& first, SubRunID const& last
+) {
+  sumdata::POTSummary total;
+  for (auto const& [ id, summary ]: summaries) {
+    if ((id < first) || (last < id)) continue;
+    total.aggregate(summary);
+  }
+  return total;
+} // referenceSum()
+
+
+/// Runs 1, 3, 5, ... 19 with subruns 1, 2, ... 2 * run
+std::map<SubRunID, sumdata::POTSummary> makeDataset() {
+  std::map<SubRunID, sumdata::POTSummary> summaries;
+  for (unsigned int run = 1U; run < 20U; run += 2U) {
+    for (unsigned int subRun = 1U; subRun <= 2U * run; ++subRun)
+      summaries.emplace(SubRunID{ run, subRun }, makeSummary(run, subRun));
+  }
+  return summaries;
+} // makeDataset()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTRangeIndex_testcase) {
+
+  std::map<SubRunID, sumdata::POTSummary> const summaries = makeDataset();
+  sumdata::POTRangeIndex const index { summaries };
+  BOOST_CHECK_EQUAL(index.size(), summaries.size());
+
+  // lookup
+  for (auto const& [ id, summary ]: summaries) {
+    sumdata::POTSummary const* found = index.find(id.run(), id.subRun());
+    BOOST_TEST_REQUIRE(found);
+    BOOST_CHECK_EQUAL(found->totpot, summary.totpot);
+    BOOST_CHECK_EQUAL(found->totspills, summary.totspills);
+  }
+  BOOST_CHECK(!index.find(2U, 1U));
+  BOOST_CHECK(!index.find(3U, 7U));
+  BOOST_CHECK(!index.find(21U, 1U));
+
+  // ranges, with boundaries in and out of the index
+  std::vector<std::pair<SubRunID, SubRunID>> const ranges {
+    { { 0U, 0U }, { 100U, 0U } }, // everything
+    { { 3U, 2U }, { 3U, 2U } }, // single subrun
+    { { 5U, 4U }, { 9U, 3U } }, // across runs
+    { { 4U, 0U }, { 6U, 100U } }, // run 5 only
+    { { 2U, 1U }, { 2U, 5U } }, // nothing
+    { { 9U, 5U }, { 7U, 1U } }, // reversed
+    };
+  for (auto const& [ first, last ]: ranges) {
+    sumdata::POTSummary const expected
+      = referenceSum(summaries, first, last);
+    sumdata::POTSummary const result = index.sum
+      (sumdata::POTRangeIndex::makeKey(first),
+       sumdata::POTRangeIndex::makeKey(last));
+    BOOST_TEST_MESSAGE("Range: run " << first.run() << " subrun "
+      << first.subRun() << " to run " << last.run()
+      << " subrun " << last.subRun());
+    BOOST_CHECK_CLOSE(result.totpot, expected.totpot, 1e-12);
+    BOOST_CHECK_CLOSE(result.totgoodpot, expected.totgoodpot, 1e-12);
+    BOOST_CHECK_EQUAL(result.totspills, expected.totspills);
+    BOOST_CHECK_EQUAL(result.goodspills, expected.goodspills);
+  } // for
+
+  // a small range keeps its precision next to a large total
+  sumdata::POTSummary const single = index.sum({ 3U, 2U }, { 3U, 2U });
+  BOOST_CHECK_EQUAL(single.totpot, makeSummary(3U, 2U).totpot);
+
+  sumdata::POTSummary const run5 = index.sumRun(5U);
+  BOOST_CHECK_EQUAL(run5.goodspills, 55); // 1 + 2 + ... + 10
+  BOOST_CHECK_CLOSE(index.total().totpot,
+    referenceSum(summaries, { 0U, 0U }, { 100U, 0U }).totpot, 1e-12);
+
+  // unsorted keys are rejected
+  using Key_t = sumdata::POTRangeIndex::Key_t;
+  BOOST_CHECK_THROW(
+    (sumdata::POTRangeIndex{
+      std::vector<Key_t>{ { 1U, 2U }, { 1U, 1U } },
+      std::vector<sumdata::POTSummary>(2)
+    }),
+    std::invalid_argument
+    );
+  BOOST_CHECK_THROW(
+    (sumdata::POTRangeIndex{
+      std::vector<Key_t>{ { 1U, 1U } }, std::vector<sumdata::POTSummary>(2)
+    }),
+    std::invalid_argument
+    );
+
+} // BOOST_AUTO_TEST_CASE(POTRangeIndex_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SampledPOTIndex_testcase) {
+
+  std::map<std::string, std::map<SubRunID, sumdata::POTSummary>> sampled;
+  sampled["numi"] = makeDataset();
+  sampled["bnb"][SubRunID{ 7U, 3U }] = makeSummary(70U, 3U);
+
+  sumdata::SampledPOTIndex const index { sampled };
+  BOOST_CHECK_EQUAL(index.nDatasets(), 2U);
+  BOOST_CHECK(index.hasDataset("bnb"));
+  BOOST_CHECK(!index.hasDataset("cosmics"));
+  BOOST_CHECK(!index.findDataset("cosmics"));
+  BOOST_CHECK_THROW(index.dataset("cosmics"), std::out_of_range);
+  BOOST_CHECK_EQUAL(index.dataset("numi").size(), sampled["numi"].size());
+
+  sumdata::POTSummary const* found = index.find("bnb", SubRunID{ 7U, 3U });
+  BOOST_TEST_REQUIRE(found);
+  BOOST_CHECK_EQUAL(found->totpot, makeSummary(70U, 3U).totpot);
+  found = index.find("numi", SubRunID{ 7U, 3U });
+  BOOST_TEST_REQUIRE(found);
+  BOOST_CHECK_EQUAL(found->totpot, makeSummary(7U, 3U).totpot);
+  BOOST_CHECK(!index.find("numi", SubRunID{ 8U, 3U }));
+  BOOST_CHECK(!index.find("cosmics", SubRunID{ 7U, 3U }));
+
+} // BOOST_AUTO_TEST_CASE(SampledPOTIndex_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTRangeIndexBuilder_testcase) {
+
+  std::map<SubRunID, sumdata::POTSummary> const summaries = makeDataset();
+
+  // records in random order, each subrun split in two halves
+  std::vector<std::pair<SubRunID, sumdata::POTSummary>> records;
+  for (auto const& [ id, summary ]: summaries) {
+    sumdata::POTSummary half = summary;
+    half.totpot /= 2.0;
+    half.totgoodpot /= 2.0;
+    half.totspills = summary.totspills / 2;
+    half.goodspills = summary.goodspills / 2;
+    sumdata::POTSummary rest = summary;
+    rest.totpot -= half.totpot;
+    rest.totgoodpot -= half.totgoodpot;
+    rest.totspills -= half.totspills;
+    rest.goodspills -= half.goodspills;
+    records.emplace_back(id, half);
+    records.emplace_back(id, rest);
+  }
+  std::shuffle(records.begin(), records.end(), std::mt19937{ 5U });
+
+  sumdata::POTRangeIndexBuilder builder;
+  for (auto const& [ id, summary ]: records) {
+    if (id.subRun() % 2) builder.add(id, summary);
+    else builder.add(id.run(), id.subRun(), summary);
+  }
+  BOOST_CHECK_EQUAL(builder.nRecords(), records.size());
+
+  sumdata::POTRangeIndex const index = builder.build();
+  sumdata::POTRangeIndex const reference { summaries };
+  BOOST_TEST_REQUIRE(index.size() == reference.size());
+  for (std::size_t i = 0; i < index.size(); ++i) {
+    BOOST_CHECK(index.keys()[i] == reference.keys()[i]);
+    sumdata::POTSummary const& summary = index.summaries()[i];
+    sumdata::POTSummary const& expected = reference.summaries()[i];
+    BOOST_CHECK_EQUAL(summary.totpot, expected.totpot);
+    BOOST_CHECK_EQUAL(summary.totgoodpot, expected.totgoodpot);
+    BOOST_CHECK_EQUAL(summary.totspills, expected.totspills);
+    BOOST_CHECK_EQUAL(summary.goodspills, expected.goodspills);
+  } // for
+
+} // BOOST_AUTO_TEST_CASE(POTRangeIndexBuilder_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTRangeIndexIO_testcase) {
+
+  sumdata::POTRangeIndex const index { makeDataset() };
+
+  std::ostringstream out;
+  sumdata::writePOTRangeIndex(out, index);
+  std::string const data = out.str();
+  BOOST_CHECK_EQUAL(data.size(), 8U + 4U + 8U + index.size() * 32U);
+
+  std::istringstream in { data };
+  sumdata::POTRangeIndex const read = sumdata::readPOTRangeIndex(in);
+  BOOST_TEST_REQUIRE(read.size() == index.size());
+  for (std::size_t i = 0; i < index.size(); ++i) {
+    BOOST_CHECK(read.keys()[i] == index.keys()[i]);
+    BOOST_CHECK_EQUAL(read.summaries()[i].totpot, index.summaries()[i].totpot);
+    BOOST_CHECK_EQUAL
+      (read.summaries()[i].goodspills, index.summaries()[i].goodspills);
+  }
+  BOOST_CHECK_EQUAL
+    (read.sum({ 5U, 4U }, { 9U, 3U }).totpot,
+     index.sum({ 5U, 4U }, { 9U, 3U }).totpot);
+
+  // negative spill counts survive the round trip
+  sumdata::POTSummary negative;
+  negative.totspills = -3;
+  sumdata::POTRangeIndex const small
+    { std::vector<sumdata::POTRangeIndex::Key_t>{ { 1U, 1U } }, { negative } };
+  std::ostringstream smallOut;
+  sumdata::writePOTRangeIndex(smallOut, small);
+  std::istringstream smallIn { smallOut.str() };
+  BOOST_CHECK_EQUAL
+    (sumdata::readPOTRangeIndex(smallIn).summaries()[0].totspills, -3);
+
+  // invalid input
+  std::istringstream truncated { data.substr(0U, data.size() - 5U) };
+  BOOST_CHECK_THROW(sumdata::readPOTRangeIndex(truncated), std::runtime_error);
+  std::string badMagic = data;
+  badMagic[0] = 'X';
+  std::istringstream badMagicIn { badMagic };
+  BOOST_CHECK_THROW(sumdata::readPOTRangeIndex(badMagicIn), std::runtime_error);
+  std::string badVersion = data;
+  badVersion[8] = 99;
+  std::istringstream badVersionIn { badVersion };
+  BOOST_CHECK_THROW
+    (sumdata::readPOTRangeIndex(badVersionIn), std::runtime_error);
+  std::string unsorted = data;
+  unsorted[20] = 100; // run of the first subrun becomes 100
+  std::istringstream unsortedIn { unsorted };
+  BOOST_CHECK_THROW(sumdata::readPOTRangeIndex(unsortedIn), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(POTRangeIndexIO_testcase)
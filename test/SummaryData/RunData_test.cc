@@ -0,0 +1,86 @@
+/**
+ * @file   RunData_test.cc
+ * @brief  Test of `sumdata::RunData` and `sumdata::InternedString`.
+ * @see    larcoreobj/SummaryData/RunData.h
+ * @see    larcoreobj/SummaryData/InternedString.h
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RunData_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/RunData.h"
+#include "larcoreobj/SummaryData/InternedString.h"
+
+// C/C++ standard libraries
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept> // std::runtime_error
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InternedString_testcase) {
+
+  sumdata::InternedString const invalid;
+  BOOST_CHECK(!invalid);
+
+  std::string name = "ICARUS";
+  sumdata::InternedString const a { name };
+  std::size_t const tableSize = sumdata::InternedString::tableSize();
+  name += "-T600";
+  sumdata::InternedString const b { std::string{ "ICARUS" } };
+  sumdata::InternedString const c { name };
+  BOOST_CHECK(a);
+  BOOST_CHECK_EQUAL(a.str(), "ICARUS");
+  BOOST_CHECK_EQUAL(c.str(), "ICARUS-T600");
+  BOOST_CHECK(a == b);
+  BOOST_CHECK(&a.str() == &b.str()); // same stored string
+  BOOST_CHECK(a != c);
+  BOOST_CHECK(a != invalid);
+  BOOST_CHECK_EQUAL(sumdata::InternedString::tableSize(), tableSize + 1U);
+
+  // concurrent interning of the same values yields the same handles
+  std::vector<sumdata::InternedString> handles(16);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    threads.emplace_back([&handles, i](){
+        for (int j = 0; j < 100; ++j) {
+          sumdata::InternedString{ "detector" + std::to_string(j) };
+        }
+        handles[i] = sumdata::InternedString{ "detector" + std::to_string(i) };
+      });
+  }
+  for (std::thread& thread: threads) thread.join();
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    BOOST_CHECK(handles[i]
+      == sumdata::InternedString{ "detector" + std::to_string(i) });
+  }
+
+} // BOOST_AUTO_TEST_CASE(InternedString_testcase)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RunDataAggregate_testcase) {
+
+  sumdata::RunData data { "MicroBooNE" };
+  BOOST_CHECK_EQUAL(data.DetName(), "MicroBooNE");
+
+  sumdata::RunData const sameDetector { std::string{ "MicroBooNE" } };
+  BOOST_CHECK_NO_THROW(data.aggregate(sameDetector));
+  BOOST_CHECK_EQUAL(data.DetName(), "MicroBooNE");
+
+  sumdata::RunData const copy = sameDetector;
+  BOOST_CHECK_NO_THROW(data.aggregate(copy));
+
+  sumdata::RunData const otherDetector { "SBND" };
+  BOOST_CHECK_THROW(data.aggregate(otherDetector), std::runtime_error);
+
+  sumdata::RunData const defaultData;
+  BOOST_CHECK_EQUAL(defaultData.DetName(), "nodetectorname");
+  BOOST_CHECK_THROW(data.aggregate(defaultData), std::runtime_error);
+  BOOST_CHECK_NO_THROW(sumdata::RunData{}.aggregate(defaultData));
+
+} // BOOST_AUTO_TEST_CASE(RunDataAggregate_testcase)